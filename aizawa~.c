@@ -0,0 +1,54 @@
+#include "attractor.h"
+
+// The Aizawa attractor
+//
+// dx = (z - b) x - d y, dy = d x + (z - b) y,
+// dz = c + a z - z^3 / 3 - (x^2 + y^2) (1 + e z) + f z x^3
+// with the input driving y
+
+static t_class* aizawa_class;
+
+static const t_attractor_param aizawa_params[] = {
+    { "a", 0.95f, 0.f, 2.f },
+    { "b", 0.7f, 0.f, 2.f },
+    { "c", 0.6f, 0.f, 2.f },
+    { "d", 3.5f, 0.f, 10.f },
+    { "e", 0.25f, 0.f, 2.f },
+    { "f", 0.1f, 0.f, 2.f },
+};
+
+static inline void aizawa_field(const float* s, const float* p, float pert, float* slope)
+{
+    float zb = s[2] - p[1];
+
+    slope[0] = zb * s[0] - p[3] * s[1];
+    slope[1] = p[3] * s[0] + zb * s[1] + pert;
+    slope[2] = p[2] + p[0] * s[2] - s[2] * s[2] * s[2] * (1.f / 3.f)
+        - (s[0] * s[0] + s[1] * s[1]) * (1.f + p[4] * s[2]) + p[5] * s[2] * s[0] * s[0] * s[0];
+}
+
+static t_int* aizawa_perform(t_int* w)
+{
+    return attractor_perform(w, aizawa_field);
+}
+
+static const t_attractor_model aizawa_model = {
+    .name = "aizawa~",
+    .perform = aizawa_perform,
+    .params = aizawa_params,
+    .nparams = 6,
+    .init = { 0.1f, 0.f, 0.f },
+    .bound = 10.f,
+    .scale = 1.f / 1.5f,
+    .speed = 0.3f,
+};
+
+static void* aizawa_new(void)
+{
+    return attractor_new(aizawa_class, &aizawa_model);
+}
+
+void aizawa_tilde_setup(void)
+{
+    aizawa_class = attractor_class_new(&aizawa_model, (t_newmethod)aizawa_new);
+}
@@ -0,0 +1,251 @@
+#pragma once
+
+#include "attractor_step.h"
+#include "bruits.h"
+#include "m_pd.h"
+#include <math.h>
+#include <stdbool.h>
+
+// A generic chaotic attractor object
+//
+// A model is a vector field over three state variables plus a description
+// of its parameters and scaling. The integrators, the clamping, the mix with
+// the input and the Pd interface are the same for all of them. The field is
+// a static inline function that is passed down to the inline kernel, so
+// every model gets its own copy of the loop with the field inlined instead
+// of a call through a pointer.
+//
+// An object only has to define its field, a perform routine handing the
+// field to attractor_perform() and the model, see lorenz~.c.
+
+static const float ATTRACTOR_FREQ_C4 = 261.6256f;
+
+#define ATTRACTOR_MAXPARAMS 8
+
+typedef struct _attractor_param {
+    const char* name;
+    float init;
+    float min;
+    float max;
+} t_attractor_param;
+
+typedef struct _attractor_model {
+    const char* name;
+    t_perfroutine perform;
+
+    const t_attractor_param* params;
+    int nparams;
+
+    float init[3]; // state after a reset
+    float bound; // every state variable is clamped to +-bound
+    float scale; // of x to the output, to about +-1
+    float speed; // time units per radian at pitch 0, so that it sounds about C4
+} t_attractor_model;
+
+typedef struct _attractor {
+    t_object x_obj;
+
+    const t_attractor_model* model;
+
+    float pitch;
+    float gain;
+    float mix;
+    float params[ATTRACTOR_MAXPARAMS];
+
+    float state[3];
+
+    float sampletime;
+    float dt;
+    attractor_integrator integrator;
+
+    t_outlet* x_outlet;
+} t_attractor;
+
+static const char* attractor_integrator_names[attractor_integrators] = { "euler", "heun", "rk4" };
+
+// --- DSP
+
+// The state and the parameters live in locals for the whole block, as in
+// ross~'s kernel.
+static inline void attractor_kernel(t_attractor* x, int frames, const t_sample* restrict extin,
+    t_sample* restrict out, const t_attractor_field field, const attractor_integrator integrator,
+    const bool external)
+{
+    float gain = x->gain;
+    float mix = x->mix;
+    float dt = x->dt;
+    float bound = x->model->bound;
+    float scale = x->model->scale;
+
+    float p[ATTRACTOR_MAXPARAMS];
+    for (int j = 0; j < ATTRACTOR_MAXPARAMS; j++)
+        p[j] = x->params[j];
+
+    float s[3] = { x->state[0], x->state[1], x->state[2] };
+
+    for (int i = 0; i < frames; i++) {
+        float ext = external ? extin[i] : 0.f;
+        float pert = external ? ext * gain : 0.f;
+
+        attractor_step(integrator, field, s, dt, p, pert);
+
+        for (int j = 0; j < 3; j++)
+            s[j] = br_clamp(s[j], -bound, bound);
+
+        out[i] = external ? s[0] * scale * (1 - mix) + mix * ext : s[0] * scale;
+    }
+
+    for (int j = 0; j < 3; j++)
+        x->state[j] = s[j];
+}
+
+static inline void attractor_run(t_attractor* x, int frames, const t_sample* extin, t_sample* out,
+    const t_attractor_field field, const attractor_integrator integrator)
+{
+    // without gain and mix the input can't reach the output
+    if (x->gain == 0 && x->mix == 0)
+        attractor_kernel(x, frames, extin, out, field, integrator, false);
+    else
+        attractor_kernel(x, frames, extin, out, field, integrator, true);
+}
+
+// the body of a model's perform routine
+static inline t_int* attractor_perform(t_int* w, const t_attractor_field field)
+{
+    t_attractor* x = (t_attractor*)(w[1]);
+    int frames = (int)w[2];
+    t_sample* extin = (t_sample*)w[3];
+    t_sample* out = (t_sample*)w[4];
+
+    switch (x->integrator) {
+    case attractor_euler:
+        attractor_run(x, frames, extin, out, field, attractor_euler);
+        break;
+    case attractor_rk4:
+        attractor_run(x, frames, extin, out, field, attractor_rk4);
+        break;
+    default:
+        attractor_run(x, frames, extin, out, field, attractor_heun);
+        break;
+    }
+
+    return (w + 5);
+}
+
+// --- interface
+
+static void attractor_update_dt(t_attractor* x)
+{
+    float pitch = ATTRACTOR_FREQ_C4 * powf(2.f, x->pitch) * 6.2831853f;
+    x->dt = x->sampletime * pitch * x->model->speed;
+}
+
+static void attractor_pitch(t_attractor* x, float pitch)
+{
+    x->pitch = br_clamp(pitch, -10, 10);
+    attractor_update_dt(x);
+}
+
+static void attractor_mix(t_attractor* x, float mix)
+{
+    x->mix = br_clamp(mix, 0.f, 1.f);
+}
+
+static void attractor_gain(t_attractor* x, float gain)
+{
+    x->gain = br_clamp(gain, 0.f, 10.f);
+}
+
+static void attractor_integrator_set(t_attractor* x, t_symbol* name)
+{
+    for (int i = 0; i < attractor_integrators; i++) {
+        if (name == gensym(attractor_integrator_names[i])) {
+            x->integrator = (attractor_integrator)i;
+            return;
+        }
+    }
+
+    pd_error(x, "%s: unknown integrator %s (euler, heun, rk4)", x->model->name, name->s_name);
+}
+
+// the model's parameters are set by name, "sigma 10"
+static void attractor_anything(t_attractor* x, t_symbol* s, int argc, t_atom* argv)
+{
+    const t_attractor_model* m = x->model;
+
+    for (int j = 0; j < m->nparams; j++) {
+        if (s == gensym(m->params[j].name)) {
+            float value = atom_getfloatarg(0, argc, argv);
+            x->params[j] = br_clamp(value, m->params[j].min, m->params[j].max);
+            return;
+        }
+    }
+
+    pd_error(x, "%s: no method for '%s'", m->name, s->s_name);
+}
+
+static void attractor_dsp(t_attractor* x, t_signal** sp)
+{
+    // the signal's rate, which differs from sys_getsr() when resampled by block~
+    x->sampletime = 1.f / sp[0]->s_sr;
+    attractor_update_dt(x);
+
+    dsp_add(x->model->perform, 4, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
+}
+
+// --- init
+
+static void attractor_reset(t_attractor* x)
+{
+    const t_attractor_model* m = x->model;
+
+    for (int j = 0; j < 3; j++)
+        x->state[j] = m->init[j];
+
+    x->pitch = 0;
+    x->gain = 0;
+    x->mix = 0.5;
+
+    for (int j = 0; j < m->nparams; j++)
+        x->params[j] = m->params[j].init;
+
+    x->integrator = attractor_heun;
+
+    attractor_update_dt(x);
+}
+
+static void* attractor_new(t_class* c, const t_attractor_model* model)
+{
+    t_attractor* x = (t_attractor*)pd_new(c);
+    x->model = model;
+    x->sampletime = 1.f / sys_getsr();
+    attractor_reset(x);
+
+    x->x_outlet = outlet_new(&x->x_obj, &s_signal);
+
+    return (void*)x;
+}
+
+static void* attractor_free(t_attractor* x)
+{
+    outlet_free(x->x_outlet);
+    return (void*)x;
+}
+
+static t_class* attractor_class_new(const t_attractor_model* model, t_newmethod newmethod)
+{
+    t_class* c = class_new(gensym(model->name), newmethod, (t_method)attractor_free,
+        sizeof(t_attractor), CLASS_DEFAULT, 0);
+
+    class_addmethod(c, nullfn, gensym("signal"), 0);
+    class_addmethod(c, (t_method)attractor_dsp, gensym("dsp"), A_CANT, 0);
+
+    class_addmethod(c, (t_method)attractor_reset, gensym("reset"), 0);
+    class_addmethod(c, (t_method)attractor_pitch, gensym("pitch"), A_FLOAT, 0);
+    class_addmethod(c, (t_method)attractor_mix, gensym("mix"), A_FLOAT, 0);
+    class_addmethod(c, (t_method)attractor_gain, gensym("gain"), A_FLOAT, 0);
+    class_addmethod(c, (t_method)attractor_integrator_set, gensym("integrator"), A_SYMBOL, 0);
+    class_addanything(c, (t_method)attractor_anything);
+
+    return c;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+// The fixed step integrators of the attractors, for any vector field
+
+// the slope of the state s for the parameters p, pert is the scaled input
+typedef void (*t_attractor_field)(const float* s, const float* p, float pert, float* slope);
+
+typedef enum attractor_integrator {
+    attractor_euler = 0,
+    attractor_heun,
+    attractor_rk4,
+    attractor_integrators,
+} attractor_integrator;
+
+// Advances the state s by one step of size h, pert is held over the step.
+// heun is ross~'s two stage step, its predictor only goes half a step.
+static inline void attractor_step(const attractor_integrator integrator, const t_attractor_field field,
+    float* s, float h, const float* p, float pert)
+{
+    float k1[3];
+    float k2[3];
+    float k3[3];
+    float k4[3];
+    float t[3];
+
+    switch (integrator) {
+    case attractor_euler:
+        field(s, p, pert, k1);
+
+        for (int j = 0; j < 3; j++)
+            s[j] += k1[j] * h;
+        break;
+
+    case attractor_heun: {
+        float half = h * 0.5f;
+        field(s, p, pert, k1);
+        for (int j = 0; j < 3; j++)
+            t[j] = s[j] + k1[j] * half;
+        field(t, p, pert, k2);
+
+        for (int j = 0; j < 3; j++)
+            s[j] += (k1[j] + k2[j]) * half;
+        break;
+    }
+
+    case attractor_rk4: {
+        float half = h * 0.5f;
+        field(s, p, pert, k1);
+        for (int j = 0; j < 3; j++)
+            t[j] = s[j] + k1[j] * half;
+        field(t, p, pert, k2);
+        for (int j = 0; j < 3; j++)
+            t[j] = s[j] + k2[j] * half;
+        field(t, p, pert, k3);
+        for (int j = 0; j < 3; j++)
+            t[j] = s[j] + k3[j] * h;
+        field(t, p, pert, k4);
+
+        for (int j = 0; j < 3; j++)
+            s[j] += (k1[j] + 2.f * (k2[j] + k3[j]) + k4[j]) * (h / 6.f);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
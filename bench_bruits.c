@@ -0,0 +1,568 @@
+#include "br_rand.h"
+#include "bruits.h"
+#include "pd_host.h"
+
+#include "mt19937ar/mt19937ar.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Microbenchmarks for the perform routines
+//
+// Every configuration renders BENCH_SECONDS of audio per trial after a
+// warmup, timing is reported as ns per output sample. The results are
+// written as JSON, a summary goes to stderr.
+//
+// Given a baseline written by an earlier run, each configuration is
+// compared by its median and flagged when it got slower than the threshold
+// and the difference is beyond the noise of both runs (median absolute
+// deviation of the trials).
+
+#define BENCH_SR 44100
+#define BENCH_SECONDS 0.25
+#define BENCH_WARMUP 0.05
+#define BENCH_MAXTRIALS 64
+#define BENCH_MAXBASELINE 1024
+
+// how many MADs a difference has to exceed to count as a regression
+#define BENCH_NOISE 3.0
+
+void ross_tilde_setup(void);
+void rossbank_tilde_setup(void);
+void lorenz_tilde_setup(void);
+void chua_tilde_setup(void);
+void thomas_tilde_setup(void);
+void aizawa_tilde_setup(void);
+void gendy_tilde_setup(void);
+
+typedef struct _bench_result {
+    char name[128];
+    const char* object;
+    int blocksize;
+    char params[256];
+    double ns[BENCH_MAXTRIALS];
+    int trials;
+    double breakpoints;
+} t_bench_result;
+
+typedef struct _bench_baseline {
+    char name[128];
+    double median;
+    double mad;
+} t_bench_baseline;
+
+static int bench_trials = 7;
+static const char* bench_filter;
+static FILE* bench_json;
+static int bench_count;
+
+static t_bench_baseline bench_baseline[BENCH_MAXBASELINE];
+static int bench_nbaseline;
+static double bench_threshold = 0.1;
+static int bench_regressions;
+
+static double bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int bench_cmp(const void* a, const void* b)
+{
+    double d = *(const double*)a - *(const double*)b;
+    return (d > 0) - (d < 0);
+}
+
+static double bench_median(const double* v, int n)
+{
+    double sorted[BENCH_MAXTRIALS];
+    memcpy(sorted, v, n * sizeof(double));
+    qsort(sorted, n, sizeof(double), bench_cmp);
+    return n % 2 ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+}
+
+static double bench_mad(const double* v, int n, double median)
+{
+    double dev[BENCH_MAXTRIALS];
+    for (int i = 0; i < n; i++)
+        dev[i] = fabs(v[i] - median);
+    return bench_median(dev, n);
+}
+
+static double bench_min(const double* v, int n)
+{
+    double m = v[0];
+    for (int i = 1; i < n; i++)
+        m = br_minimum(m, v[i]);
+    return m;
+}
+
+// render the object's dsp chain for the given duration, returns ns/sample
+static double bench_render(t_object* x, int blocksize, double seconds, double* elapsed)
+{
+    int blocks = (int)(seconds * BENCH_SR / blocksize) + 1;
+
+    double start = bench_now();
+    for (int b = 0; b < blocks; b++)
+        host_tick(x);
+    double ns = bench_now() - start;
+
+    if (elapsed)
+        *elapsed += ns;
+    return ns / ((double)blocks * blocksize);
+}
+
+static unsigned long long gendy_breakpoints(t_object* x)
+{
+    // the last line posted by debug is the breakpoint counter
+    host_bang(x, "debug");
+    return strtoull(host_lastpost() + strlen("breakpoints "), 0, 10);
+}
+
+// --- baseline
+
+static int bench_load(const char* path)
+{
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    char* json = malloc(size + 1);
+    json[fread(json, 1, size, f)] = 0;
+    fclose(f);
+
+    // only our own output is read, one result object per name
+    const char* p = json;
+    while ((p = strstr(p, "\"name\": \"")) && bench_nbaseline < BENCH_MAXBASELINE) {
+        t_bench_baseline* b = &bench_baseline[bench_nbaseline];
+        p += strlen("\"name\": \"");
+
+        size_t len = strcspn(p, "\"");
+        snprintf(b->name, sizeof(b->name), "%.*s", (int)len, p);
+
+        const char* median = strstr(p, "\"median\": ");
+        const char* mad = strstr(p, "\"mad\": ");
+        if (!median || !mad)
+            break;
+
+        b->median = strtod(median + strlen("\"median\": "), 0);
+        b->mad = strtod(mad + strlen("\"mad\": "), 0);
+        bench_nbaseline++;
+    }
+
+    free(json);
+    return 0;
+}
+
+static const t_bench_baseline* bench_find(const char* name)
+{
+    for (int i = 0; i < bench_nbaseline; i++) {
+        if (!strcmp(bench_baseline[i].name, name))
+            return &bench_baseline[i];
+    }
+    return 0;
+}
+
+static void bench_report(t_bench_result* r)
+{
+    double median = bench_median(r->ns, r->trials);
+    double mad = bench_mad(r->ns, r->trials, median);
+    double fastest = bench_min(r->ns, r->trials);
+
+    fprintf(stderr, "%-52s %9.2f ns/sample +-%6.2f", r->name, median, mad);
+    if (r->breakpoints > 0)
+        fprintf(stderr, " %12.0f breakpoints/s", r->breakpoints);
+
+    const t_bench_baseline* base = bench_find(r->name);
+    double change = 0;
+    if (base) {
+        double delta = median - base->median;
+        change = delta / base->median;
+        fprintf(stderr, " %+7.1f%%", 100 * change);
+
+        if (change > bench_threshold && delta > BENCH_NOISE * (mad + base->mad)) {
+            fprintf(stderr, " REGRESSION");
+            bench_regressions++;
+        }
+    }
+    fprintf(stderr, "\n");
+
+    fprintf(bench_json, "%s\n    {\"name\": \"%s\", \"object\": \"%s\", \"blocksize\": %d, ",
+        bench_count++ ? "," : "", r->name, r->object, r->blocksize);
+    fprintf(bench_json, "\"params\": {%s}, ", r->params);
+    fprintf(bench_json, "\"ns_per_sample\": {\"median\": %.4f, \"mad\": %.4f, \"min\": %.4f, \"trials\": [",
+        median, mad, fastest);
+    for (int i = 0; i < r->trials; i++)
+        fprintf(bench_json, "%s%.4f", i ? ", " : "", r->ns[i]);
+    fprintf(bench_json, "]}");
+    if (r->breakpoints > 0)
+        fprintf(bench_json, ", \"breakpoints_per_sec\": %.1f", r->breakpoints);
+    if (base)
+        fprintf(bench_json, ", \"change\": %.4f", change);
+    fprintf(bench_json, "}");
+}
+
+static int bench_skip(const char* name)
+{
+    return bench_filter && !strstr(name, bench_filter);
+}
+
+// --- gendy~
+
+static void bench_gendy(int blocksize, int knum, int dist, float minfreq, float maxfreq)
+{
+    t_bench_result r = { .object = "gendy~", .blocksize = blocksize, .trials = bench_trials };
+    snprintf(r.name, sizeof(r.name), "gendy~/bs%d/knum%d/dist%d/freq%g-%g",
+        blocksize, knum, dist, minfreq, maxfreq);
+    snprintf(r.params, sizeof(r.params),
+        "\"knum\": %d, \"dist\": %d, \"minfreq\": %g, \"maxfreq\": %g",
+        knum, dist, minfreq, maxfreq);
+
+    if (bench_skip(r.name))
+        return;
+
+    t_object* x = host_new("gendy~", 0, 0);
+    host_float(x, "seed", 1);
+
+    host_float(x, "knum", knum);
+    host_float(x, "ampdist", dist);
+    host_float(x, "durdist", dist);
+    host_float(x, "minfreq", minfreq);
+    host_float(x, "maxfreq", maxfreq);
+    host_dsp(x, blocksize);
+
+    bench_render(x, blocksize, BENCH_WARMUP, 0);
+
+    double elapsed = 0;
+    unsigned long long before = gendy_breakpoints(x);
+    for (int t = 0; t < r.trials; t++)
+        r.ns[t] = bench_render(x, blocksize, BENCH_SECONDS, &elapsed);
+    r.breakpoints = (gendy_breakpoints(x) - before) / (elapsed * 1e-9);
+
+    bench_report(&r);
+    host_free(x);
+}
+
+// --- random numbers
+
+typedef enum _bench_generator {
+    bench_mt,
+    bench_mt_bulk,
+    bench_xoshiro,
+    bench_pcg32,
+    bench_philox,
+    bench_philox_bulk,
+} bench_generator;
+
+static const char* bench_generator_names[] = { "mt19937ar", "mt19937ar", "xoshiro256+", "pcg32",
+    "philox4x32", "philox4x32" };
+
+typedef struct _bench_rng {
+    mt_state mt;
+    t_br_xoshiro xoshiro;
+    t_br_pcg32 pcg32;
+    t_br_philox philox;
+} t_bench_rng;
+
+// draws blocksize numbers at a time for the given duration, returns ns/number
+static double bench_draw(t_bench_rng* rng, double* dest, int blocksize, bench_generator g,
+    double seconds)
+{
+    int blocks = (int)(seconds * BENCH_SR / blocksize) + 1;
+
+    double start = bench_now();
+    for (int b = 0; b < blocks; b++) {
+        switch (g) {
+        case bench_mt:
+            for (int i = 0; i < blocksize; i++)
+                dest[i] = mt_genrand_real1(&rng->mt);
+            break;
+        case bench_mt_bulk:
+            mt_fill_real1(&rng->mt, dest, blocksize);
+            break;
+        case bench_xoshiro:
+            for (int i = 0; i < blocksize; i++)
+                dest[i] = br_xoshiro_uniform(&rng->xoshiro);
+            break;
+        case bench_pcg32:
+            for (int i = 0; i < blocksize; i++)
+                dest[i] = br_pcg32_uniform(&rng->pcg32);
+            break;
+        case bench_philox:
+            for (int i = 0; i < blocksize; i++)
+                dest[i] = br_philox_uniform(&rng->philox);
+            break;
+        case bench_philox_bulk:
+            br_philox_fill(&rng->philox, dest, blocksize);
+            break;
+        }
+    }
+    double ns = bench_now() - start;
+
+    return ns / ((double)blocks * blocksize);
+}
+
+// the uniform numbers behind gendy~, the Mersenne Twister one call per
+// number and in bulk against the small generators of br_rand.h
+static void bench_uniform(int blocksize, bench_generator g)
+{
+    const char* name = bench_generator_names[g];
+    t_bench_result r = { .object = name, .blocksize = blocksize, .trials = bench_trials };
+    bool bulk = g == bench_mt_bulk || g == bench_philox_bulk;
+    snprintf(r.name, sizeof(r.name), "%s/bs%d%s", name, blocksize, bulk ? "/bulk" : "");
+    snprintf(r.params, sizeof(r.params), "\"bulk\": %s", bulk ? "true" : "false");
+
+    if (bench_skip(r.name))
+        return;
+
+    static t_bench_rng rng;
+    double* dest = malloc(blocksize * sizeof(double));
+    mt_init(&rng.mt, 1);
+    br_xoshiro_seed(&rng.xoshiro, 1);
+    br_pcg32_seed(&rng.pcg32, 1, 1);
+    br_philox_seed(&rng.philox, 1, 0);
+
+    bench_draw(&rng, dest, blocksize, g, BENCH_WARMUP);
+    for (int t = 0; t < r.trials; t++)
+        r.ns[t] = bench_draw(&rng, dest, blocksize, g, BENCH_SECONDS);
+
+    bench_report(&r);
+    free(dest);
+}
+
+// --- ross~
+
+// flag is a creation argument or empty
+static void bench_ross(int blocksize, float pitch, const char* variant, const char* flag,
+    const char* messages)
+{
+    t_bench_result r = { .object = "ross~", .blocksize = blocksize, .trials = bench_trials };
+    snprintf(r.name, sizeof(r.name), "ross~/bs%d/pitch%g%s%s", blocksize, pitch,
+        *variant ? "/" : "", variant);
+    snprintf(r.params, sizeof(r.params), "\"pitch\": %g, \"flag\": \"%s\", \"messages\": \"%s\"",
+        pitch, flag, messages);
+
+    if (bench_skip(r.name))
+        return;
+
+    t_atom argv[1];
+    SETSYMBOL(&argv[0], gensym(flag));
+    t_object* x = host_new("ross~", *flag ? 1 : 0, argv);
+    host_float(x, "pitch", pitch);
+    host_sendlist(x, messages);
+    host_dsp(x, blocksize);
+
+    // a tone on the input, an octave of vibrato on the pitch inlet or a
+    // wobble on the coefficient inlets, which nothing overwrites
+    for (int i = 0; i < blocksize; i++) {
+        float lfo = sinf(6.2831853f * i / blocksize);
+        if (!strcmp(variant, "driven"))
+            host_in(x, 0)[i] = lfo;
+        if (!strcmp(variant, "fm"))
+            host_in(x, 1)[i] = lfo;
+        if (!strcmp(variant, "abc")) {
+            host_in(x, 2)[i] = 0.05f * lfo;
+            host_in(x, 3)[i] = 0.05f * lfo;
+            host_in(x, 4)[i] = lfo;
+        }
+    }
+
+    bench_render(x, blocksize, BENCH_WARMUP, 0);
+    for (int t = 0; t < r.trials; t++)
+        r.ns[t] = bench_render(x, blocksize, BENCH_SECONDS, 0);
+
+    bench_report(&r);
+    host_free(x);
+}
+
+// --- lorenz~, chua~, thomas~, aizawa~
+
+static void bench_attractor(const char* object, int blocksize, const char* variant, const char* messages)
+{
+    t_bench_result r = { .object = object, .blocksize = blocksize, .trials = bench_trials };
+    snprintf(r.name, sizeof(r.name), "%s/bs%d%s%s", object, blocksize, *variant ? "/" : "", variant);
+    snprintf(r.params, sizeof(r.params), "\"messages\": \"%s\"", messages);
+
+    if (bench_skip(r.name))
+        return;
+
+    t_object* x = host_new(object, 0, 0);
+    host_sendlist(x, messages);
+    host_dsp(x, blocksize);
+
+    bench_render(x, blocksize, BENCH_WARMUP, 0);
+    for (int t = 0; t < r.trials; t++)
+        r.ns[t] = bench_render(x, blocksize, BENCH_SECONDS, 0);
+
+    bench_report(&r);
+    host_free(x);
+}
+
+// --- rossbank~
+
+static void bench_rossbank(int blocksize, int voices, bool multichannel, bool coupled)
+{
+    t_bench_result r = { .object = "rossbank~", .blocksize = blocksize, .trials = bench_trials };
+    snprintf(r.name, sizeof(r.name), "rossbank~/bs%d/voices%d%s%s", blocksize, voices,
+        multichannel ? "/mc" : "", coupled ? "/coupled" : "");
+    snprintf(r.params, sizeof(r.params), "\"voices\": %d, \"multichannel\": %s, \"coupled\": %s",
+        voices, multichannel ? "true" : "false", coupled ? "true" : "false");
+
+    if (bench_skip(r.name))
+        return;
+
+    t_atom argv[2];
+    SETSYMBOL(&argv[0], gensym("-mc"));
+    SETFLOAT(&argv[1], voices);
+    t_object* x = multichannel ? host_new("rossbank~", 2, argv) : host_new("rossbank~", 1, argv + 1);
+
+    // spread the voices over an octave
+    for (int v = 0; v < voices; v++) {
+        SETFLOAT(&argv[0], v);
+        SETFLOAT(&argv[1], (float)v / voices);
+        host_send(x, "pitch", 2, argv);
+    }
+    if (coupled)
+        host_sendlist(x, "couple 0.5");
+    host_dsp(x, blocksize);
+
+    bench_render(x, blocksize, BENCH_WARMUP, 0);
+    for (int t = 0; t < r.trials; t++)
+        r.ns[t] = bench_render(x, blocksize, BENCH_SECONDS, 0);
+
+    bench_report(&r);
+    host_free(x);
+}
+
+// ---
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bench_bruits [-o results.json] [-n trials] "
+                    "[-b baseline.json] [-t threshold%%] [filter]\n");
+    exit(1);
+}
+
+int main(int argc, char** argv)
+{
+    const char* path = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc)
+            path = argv[++i];
+        else if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+            int trials = atoi(argv[++i]);
+            bench_trials = br_clamp(trials, 1, BENCH_MAXTRIALS);
+        } else if (!strcmp(argv[i], "-b") && i + 1 < argc) {
+            if (bench_load(argv[++i]))
+                return 1;
+        } else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+            bench_threshold = atof(argv[++i]) / 100;
+        else if (argv[i][0] == '-')
+            usage();
+        else
+            bench_filter = argv[i];
+    }
+
+    bench_json = path ? fopen(path, "w") : stdout;
+    if (!bench_json) {
+        perror(path);
+        return 1;
+    }
+
+    host_init(BENCH_SR, 64);
+    ross_tilde_setup();
+    rossbank_tilde_setup();
+    lorenz_tilde_setup();
+    chua_tilde_setup();
+    thomas_tilde_setup();
+    aizawa_tilde_setup();
+    gendy_tilde_setup();
+
+    static const int blocksizes[] = { 1, 64, 1024 };
+    static const int knums[] = { 1, 12, 128 };
+    static const float freqs[][2] = { { 20, 40 }, { 220, 440 }, { 2000, 8000 } };
+    static const float pitches[] = { -4, 0, 4 };
+    static const int voices[] = { 8, 64, 256 };
+    static const char* attractors[] = { "lorenz~", "chua~", "thomas~", "aizawa~" };
+
+    // dry runs without gain and mix, which leaves the input out, driven has
+    // a signal on the input while the others get silence, yz adds the
+    // y and z outlets, fm and abc modulate the pitch and coefficient inlets,
+    // double integrates in double precision, cache plays a recorded window
+    // once it is warmed up
+    static const char* ross_variants[][3] = {
+        { "", "", "" },
+        { "dry", "", "mix 0" },
+        { "driven", "", "gain 1" },
+        { "euler", "", "integrator euler" },
+        { "rk4", "", "integrator rk4" },
+        { "semi", "", "integrator semi" },
+        { "dopri", "", "integrator dopri" },
+        { "yz", "-yz", "" },
+        { "fm", "", "" },
+        { "abc", "", "" },
+        { "double", "-double", "" },
+        { "double/rk4", "-double", "integrator rk4" },
+        { "cache", "", "cache 0.02 0.02" },
+    };
+
+    // get the cpu out of any power saving state before the first timing
+    double spin = bench_now();
+    while (bench_now() - spin < 0.5e9)
+        ;
+
+    fprintf(bench_json, "{\n  \"samplerate\": %d,\n  \"trials\": %d,\n  \"results\": [",
+        BENCH_SR, bench_trials);
+
+    for (int b = 0; b < 3; b++) {
+        for (int k = 0; k < 3; k++) {
+            for (int d = 0; d < 6; d++) {
+                for (int f = 0; f < 3; f++)
+                    bench_gendy(blocksizes[b], knums[k], d, freqs[f][0], freqs[f][1]);
+            }
+        }
+
+        for (int g = bench_mt; g <= bench_philox_bulk; g++)
+            bench_uniform(blocksizes[b], (bench_generator)g);
+
+        for (int p = 0; p < 3; p++) {
+            for (size_t v = 0; v < sizeof(ross_variants) / sizeof(ross_variants[0]); v++)
+                bench_ross(blocksizes[b], pitches[p], ross_variants[v][0], ross_variants[v][1],
+                    ross_variants[v][2]);
+        }
+
+        for (int a = 0; a < 4; a++) {
+            bench_attractor(attractors[a], blocksizes[b], "", "");
+            bench_attractor(attractors[a], blocksizes[b], "rk4", "integrator rk4");
+        }
+
+        for (int v = 0; v < 3; v++) {
+            bench_rossbank(blocksizes[b], voices[v], false, false);
+            bench_rossbank(blocksizes[b], voices[v], true, false);
+            bench_rossbank(blocksizes[b], voices[v], true, true);
+        }
+    }
+
+    fprintf(bench_json, "\n  ]\n}\n");
+
+    if (path)
+        fclose(bench_json);
+
+    if (bench_nbaseline) {
+        fprintf(stderr, "%d configuration(s) regressed by more than %g%%\n",
+            bench_regressions, 100 * bench_threshold);
+    }
+    return bench_regressions ? 2 : 0;
+}
@@ -0,0 +1,304 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "mt19937ar/mt19937ar.h"
+
+// Random numbers for the objects
+//
+// Each generator keeps its state in a struct owned by the caller. The
+// t_br_rand type and the br_rand_ functions use the generator chosen at
+// compile time:
+//
+// - xoshiro256+ by default, with 32 bytes of state
+// - PCG32 with -DBR_RAND_PCG, with 16 bytes of state
+// - the Mersenne Twister with -DBR_RAND_MT, with 2.5 KB of state
+// - Philox4x32-10 with -DBR_RAND_PHILOX, with 40 bytes of state
+//
+// The small states make a generator per voice affordable in large banks.
+// Philox is counter based, every number is a pure function of the seed, a
+// voice and its position, so streams can be split across threads or
+// skipped ahead and still give the same numbers.
+//
+// The generators are all available under their own names as well, for the
+// tests.
+
+// a word on [0,1], SSE only converts signed words to double so the top bit
+// goes through the sign, which lets the conversion vectorize
+static inline double br_u32_unit(uint32_t x)
+{
+    return ((double)(int32_t)(x ^ 0x80000000U) + 2147483648.0) * (1.0 / 4294967295.0);
+}
+
+// --- xoshiro256+, after Blackman and Vigna
+
+typedef struct _br_xoshiro {
+    uint64_t s[4];
+} t_br_xoshiro;
+
+static inline uint64_t br_rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+// expands a seed into well mixed words, as the authors recommend for the
+// initial state
+static inline uint64_t br_splitmix64(uint64_t* x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static inline void br_xoshiro_seed(t_br_xoshiro* r, uint64_t seed)
+{
+    for (int i = 0; i < 4; i++)
+        r->s[i] = br_splitmix64(&seed);
+}
+
+static inline uint64_t br_xoshiro_next(t_br_xoshiro* r)
+{
+    uint64_t* s = r->s;
+    uint64_t result = s[0] + s[3];
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = br_rotl(s[3], 45);
+
+    return result;
+}
+
+// on [0,1], from the upper 53 bits as the lowest ones are weak
+static inline double br_xoshiro_uniform(t_br_xoshiro* r)
+{
+    return (br_xoshiro_next(r) >> 11) * (1.0 / 9007199254740991.0);
+}
+
+// --- PCG32, after O'Neill
+
+typedef struct _br_pcg32 {
+    uint64_t state;
+    uint64_t inc;
+} t_br_pcg32;
+
+static inline uint32_t br_pcg32_next(t_br_pcg32* r)
+{
+    uint64_t old = r->state;
+    r->state = old * 6364136223846793005ULL + r->inc;
+
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rot = (uint32_t)(old >> 59);
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+// seq selects one of 2^63 streams
+static inline void br_pcg32_seed(t_br_pcg32* r, uint64_t seed, uint64_t seq)
+{
+    r->state = 0;
+    r->inc = (seq << 1) | 1;
+    br_pcg32_next(r);
+    r->state += seed;
+    br_pcg32_next(r);
+}
+
+// on [0,1]
+static inline double br_pcg32_uniform(t_br_pcg32* r)
+{
+    return br_pcg32_next(r) * (1.0 / 4294967295.0);
+}
+
+// --- Philox4x32-10, after Salmon, Moraes, Dror and Shaw
+
+typedef struct _br_philox {
+    uint32_t key[2]; // the seed
+    uint32_t voice;
+    uint64_t position; // of the next number in the voice's stream
+    uint32_t block[4]; // the numbers of the counter at position
+} t_br_philox;
+
+// the 10 rounds of the bijection from a counter and a key to four words
+static inline void br_philox4x32(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])
+{
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint32_t k0 = key[0], k1 = key[1];
+
+    for (int r = 0; r < 10; r++) {
+        uint64_t p0 = (uint64_t)0xd2511f53U * c0;
+        uint64_t p1 = (uint64_t)0xcd9e8d57U * c2;
+
+        c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        c1 = (uint32_t)p1;
+        c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c3 = (uint32_t)p0;
+
+        k0 += 0x9e3779b9U;
+        k1 += 0xbb67ae85U;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+// the four numbers of counter n in a voice's stream
+static inline void br_philox_block(const t_br_philox* r, uint64_t n, uint32_t out[4])
+{
+    const uint32_t ctr[4] = { (uint32_t)n, (uint32_t)(n >> 32), r->voice, 0 };
+    br_philox4x32(ctr, r->key, out);
+}
+
+// moves to number n of the voice's stream
+static inline void br_philox_seek(t_br_philox* r, uint64_t n)
+{
+    r->position = n;
+    if (n & 3)
+        br_philox_block(r, n >> 2, r->block);
+}
+
+static inline void br_philox_seed(t_br_philox* r, uint64_t seed, uint32_t voice)
+{
+    r->key[0] = (uint32_t)seed;
+    r->key[1] = (uint32_t)(seed >> 32);
+    r->voice = voice;
+    br_philox_seek(r, 0);
+}
+
+static inline uint32_t br_philox_next(t_br_philox* r)
+{
+    if ((r->position & 3) == 0)
+        br_philox_block(r, r->position >> 2, r->block);
+    return r->block[r->position++ & 3];
+}
+
+// on [0,1]
+static inline double br_philox_uniform(t_br_philox* r)
+{
+    return br_philox_next(r) * (1.0 / 4294967295.0);
+}
+
+// number n of a voice's stream on [0,1], without a state
+static inline double br_philox_at(uint64_t seed, uint32_t voice, uint64_t n)
+{
+    t_br_philox r;
+    br_philox_seed(&r, seed, voice);
+    br_philox_seek(&r, n);
+    return br_philox_uniform(&r);
+}
+
+// fills out[0..n-1] with the numbers br_philox_uniform() would return,
+// whole counters at a time
+static inline void br_philox_fill(t_br_philox* r, double* out, int n)
+{
+    while (n > 0 && (r->position & 3)) {
+        *out++ = br_philox_uniform(r);
+        n--;
+    }
+
+    for (; n >= 4; n -= 4) {
+        uint32_t words[4];
+        br_philox_block(r, r->position >> 2, words);
+        for (int j = 0; j < 4; j++)
+            out[j] = br_u32_unit(words[j]);
+        r->position += 4;
+        out += 4;
+    }
+
+    while (n-- > 0)
+        *out++ = br_philox_uniform(r);
+}
+
+// --- the generator of the objects
+
+#if defined(BR_RAND_MT)
+
+typedef mt_state t_br_rand;
+
+static inline void br_rand_seed(t_br_rand* r, uint64_t seed)
+{
+    mt_init(r, (unsigned long)(seed & 0xffffffffUL));
+}
+
+static inline double br_rand_uniform(t_br_rand* r)
+{
+    return mt_genrand_real1(r);
+}
+
+static inline void br_rand_fill(t_br_rand* r, double* out, int n)
+{
+    mt_fill_real1(r, out, n);
+}
+
+#elif defined(BR_RAND_PHILOX)
+
+typedef t_br_philox t_br_rand;
+
+static inline void br_rand_seed(t_br_rand* r, uint64_t seed)
+{
+    br_philox_seed(r, seed, 0);
+}
+
+static inline double br_rand_uniform(t_br_rand* r)
+{
+    return br_philox_uniform(r);
+}
+
+static inline void br_rand_fill(t_br_rand* r, double* out, int n)
+{
+    br_philox_fill(r, out, n);
+}
+
+#else
+
+#if defined(BR_RAND_PCG)
+
+typedef t_br_pcg32 t_br_rand;
+
+static inline void br_rand_seed(t_br_rand* r, uint64_t seed)
+{
+    // the stream of the reference implementation's default state
+    br_pcg32_seed(r, seed, 0xda3e39cb94b95bdbULL);
+}
+
+static inline double br_rand_uniform(t_br_rand* r)
+{
+    return br_pcg32_uniform(r);
+}
+
+#else
+
+typedef t_br_xoshiro t_br_rand;
+
+static inline void br_rand_seed(t_br_rand* r, uint64_t seed)
+{
+    br_xoshiro_seed(r, seed);
+}
+
+static inline double br_rand_uniform(t_br_rand* r)
+{
+    return br_xoshiro_uniform(r);
+}
+
+#endif
+
+// fills out[0..n-1] with the numbers br_rand_uniform() would return
+static inline void br_rand_fill(t_br_rand* r, double* out, int n)
+{
+    for (int i = 0; i < n; i++)
+        out[i] = br_rand_uniform(r);
+}
+
+#endif
+
+// the seed of instance n from a master seed, a hash so that neighbouring
+// instances and master seeds give unrelated seeds
+static inline uint64_t br_rand_derive(uint64_t master, uint64_t n)
+{
+    uint64_t x = master ^ (n * 0xd1b54a32d192ed03ULL);
+    return br_splitmix64(&x);
+}
@@ -1,5 +1,44 @@
 #pragma once
 
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
 #define br_minimum(x, y) (y < x ? y : x)
 #define br_maximum(x, y) (x < y ? y : x)
 #define br_clamp(x, minVal, maxVal) (br_minimum(br_maximum(x, minVal), maxVal))
+
+// 2^x from a polynomial for the fraction and the exponent bits for the
+// integer part, relative error below 2e-7, x is clamped to +-125. The
+// polynomial is slightly below 1 at 0, so at -126 the result would be
+// subnormal and flush to zero under -ffast-math.
+static inline float br_exp2(float x)
+{
+    x = br_clamp(x, -125.f, 125.f);
+
+    int32_t i = (int32_t)x;
+    i -= x < (float)i;
+    float f = x - (float)i;
+
+    float p = 1.8775767e-3f;
+    p = p * f + 8.9893397e-3f;
+    p = p * f + 5.5826318e-2f;
+    p = p * f + 2.4015361e-1f;
+    p = p * f + 6.9315308e-1f;
+    p = p * f + 9.9999994e-1f;
+
+    uint32_t bits;
+    memcpy(&bits, &p, sizeof(bits));
+    bits += (uint32_t)i << 23;
+    memcpy(&p, &bits, sizeof(p));
+    return p;
+}
+
+// false for NaN and infinity, from the exponent bits as -ffast-math lets
+// the compiler assume that isfinite() always holds
+static inline bool br_finite(float x)
+{
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return (bits & 0x7f800000) != 0x7f800000;
+}
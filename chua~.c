@@ -0,0 +1,51 @@
+#include "attractor.h"
+
+// Chua's circuit, dimensionless with a piecewise linear diode
+//
+// dx = alpha (y - x - f(x)), dy = x - y + z, dz = -beta y
+// f(x) = m1 x + (m0 - m1) (|x + 1| - |x - 1|) / 2
+// with the input driving y
+
+static t_class* chua_class;
+
+static const t_attractor_param chua_params[] = {
+    { "alpha", 15.6f, 0.f, 50.f },
+    { "beta", 28.f, 0.f, 100.f },
+    { "m0", -1.143f, -5.f, 5.f },
+    { "m1", -0.714f, -5.f, 5.f },
+};
+
+static inline void chua_field(const float* s, const float* p, float pert, float* slope)
+{
+    float diode = p[3] * s[0] + 0.5f * (p[2] - p[3]) * (fabsf(s[0] + 1.f) - fabsf(s[0] - 1.f));
+
+    slope[0] = p[0] * (s[1] - s[0] - diode);
+    slope[1] = s[0] - s[1] + s[2] + pert;
+    slope[2] = -p[1] * s[1];
+}
+
+static t_int* chua_perform(t_int* w)
+{
+    return attractor_perform(w, chua_field);
+}
+
+static const t_attractor_model chua_model = {
+    .name = "chua~",
+    .perform = chua_perform,
+    .params = chua_params,
+    .nparams = 4,
+    .init = { 0.7f, 0.f, 0.f },
+    .bound = 20.f,
+    .scale = 1.f / 2.5f,
+    .speed = 0.9f,
+};
+
+static void* chua_new(void)
+{
+    return attractor_new(chua_class, &chua_model);
+}
+
+void chua_tilde_setup(void)
+{
+    chua_class = attractor_class_new(&chua_model, (t_newmethod)chua_new);
+}
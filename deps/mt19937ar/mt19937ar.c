@@ -44,21 +44,25 @@
 */
 
 #include <stdio.h>
+#include <stdint.h>
 #include "mt19937ar.h"
 
 /* Period parameters */  
-#define N 624
+#define N MT_N
 #define M 397
 #define MATRIX_A 0x9908b0dfUL   /* constant vector a */
 #define UPPER_MASK 0x80000000UL /* most significant w-r bits */
 #define LOWER_MASK 0x7fffffffUL /* least significant r bits */
 
-static unsigned long mt[N]; /* the array for the state vector  */
-static int mti=N+1; /* mti==N+1 means mt[N] is not initialized */
+/* the state of the functions without an explicit state */
+static mt_state global = { {0}, N+1 }; /* mti==N+1 means mt[N] is not initialized */
 
 /* initializes mt[N] with a seed */
-void init_genrand(unsigned long s)
+void mt_init(mt_state *state, unsigned long s)
 {
+    unsigned long *mt = state->mt;
+    int mti;
+
     mt[0]= s & 0xffffffffUL;
     for (mti=1; mti<N; mti++) {
         mt[mti] = 
@@ -70,16 +74,18 @@ void init_genrand(unsigned long s)
         mt[mti] &= 0xffffffffUL;
         /* for >32 bit machines */
     }
+    state->mti = mti;
 }
 
 /* initialize by an array with array-length */
 /* init_key is the array for initializing keys */
 /* key_length is its length */
 /* slight change for C++, 2004/2/26 */
-void init_by_array(unsigned long init_key[], int key_length)
+void mt_init_by_array(mt_state *state, unsigned long init_key[], int key_length)
 {
+    unsigned long *mt = state->mt;
     int i, j, k;
-    init_genrand(19650218UL);
+    mt_init(state, 19650218UL);
     i=1; j=0;
     k = (N>key_length ? N : key_length);
     for (; k; k--) {
@@ -101,34 +107,41 @@ void init_by_array(unsigned long init_key[], int key_length)
     mt[0] = 0x80000000UL; /* MSB is 1; assuring non-zero initial array */ 
 }
 
-/* generates a random number on [0,0xffffffff]-interval */
-unsigned long genrand_int32(void)
+/* generate N words at one time */
+static void mt_next_state(mt_state *state)
 {
+    unsigned long *mt = state->mt;
     unsigned long y;
-    static unsigned long mag01[2]={0x0UL, MATRIX_A};
+    static const unsigned long mag01[2]={0x0UL, MATRIX_A};
     /* mag01[x] = x * MATRIX_A  for x=0,1 */
+    int kk;
 
-    if (mti >= N) { /* generate N words at one time */
-        int kk;
+    if (state->mti == N+1)   /* if mt_init() has not been called, */
+        mt_init(state, 5489UL); /* a default initial seed is used */
 
-        if (mti == N+1)   /* if init_genrand() has not been called, */
-            init_genrand(5489UL); /* a default initial seed is used */
+    for (kk=0;kk<N-M;kk++) {
+        y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
+        mt[kk] = mt[kk+M] ^ (y >> 1) ^ mag01[y & 0x1UL];
+    }
+    for (;kk<N-1;kk++) {
+        y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
+        mt[kk] = mt[kk+(M-N)] ^ (y >> 1) ^ mag01[y & 0x1UL];
+    }
+    y = (mt[N-1]&UPPER_MASK)|(mt[0]&LOWER_MASK);
+    mt[N-1] = mt[M-1] ^ (y >> 1) ^ mag01[y & 0x1UL];
 
-        for (kk=0;kk<N-M;kk++) {
-            y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
-            mt[kk] = mt[kk+M] ^ (y >> 1) ^ mag01[y & 0x1UL];
-        }
-        for (;kk<N-1;kk++) {
-            y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
-            mt[kk] = mt[kk+(M-N)] ^ (y >> 1) ^ mag01[y & 0x1UL];
-        }
-        y = (mt[N-1]&UPPER_MASK)|(mt[0]&LOWER_MASK);
-        mt[N-1] = mt[M-1] ^ (y >> 1) ^ mag01[y & 0x1UL];
+    state->mti = 0;
+}
 
-        mti = 0;
-    }
+/* generates a random number on [0,0xffffffff]-interval */
+unsigned long mt_genrand_int32(mt_state *state)
+{
+    unsigned long y;
+
+    if (state->mti >= N)
+        mt_next_state(state);
   
-    y = mt[mti++];
+    y = state->mt[state->mti++];
 
     /* Tempering */
     y ^= (y >> 11);
@@ -140,36 +153,112 @@ unsigned long genrand_int32(void)
 }
 
 /* generates a random number on [0,0x7fffffff]-interval */
-long genrand_int31(void)
+long mt_genrand_int31(mt_state *state)
 {
-    return (long)(genrand_int32()>>1);
+    return (long)(mt_genrand_int32(state)>>1);
 }
 
 /* generates a random number on [0,1]-real-interval */
-double genrand_real1(void)
+double mt_genrand_real1(mt_state *state)
 {
-    return genrand_int32()*(1.0/4294967295.0); 
+    return mt_genrand_int32(state)*(1.0/4294967295.0); 
     /* divided by 2^32-1 */ 
 }
 
 /* generates a random number on [0,1)-real-interval */
-double genrand_real2(void)
+double mt_genrand_real2(mt_state *state)
 {
-    return genrand_int32()*(1.0/4294967296.0); 
+    return mt_genrand_int32(state)*(1.0/4294967296.0); 
     /* divided by 2^32 */
 }
 
 /* generates a random number on (0,1)-real-interval */
-double genrand_real3(void)
+double mt_genrand_real3(mt_state *state)
 {
-    return (((double)genrand_int32()) + 0.5)*(1.0/4294967296.0); 
+    return (((double)mt_genrand_int32(state)) + 0.5)*(1.0/4294967296.0); 
     /* divided by 2^32 */
 }
 
 /* generates a random number on [0,1) with 53-bit resolution*/
-double genrand_res53(void) 
+double mt_genrand_res53(mt_state *state) 
 { 
-    unsigned long a=genrand_int32()>>5, b=genrand_int32()>>6; 
+    unsigned long a=mt_genrand_int32(state)>>5, b=mt_genrand_int32(state)>>6; 
     return(a*67108864.0+b)*(1.0/9007199254740992.0); 
 } 
 /* These real versions are due to Isaku Wada, 2002/01/09 added */
+
+/* fills out[0..n-1] with the numbers mt_genrand_real1() would return */
+/* The table is tempered a run at a time, a loop without branches or */
+/* dependencies between the words that the compiler can vectorize. */
+void mt_fill_real1(mt_state *state, double *out, int n)
+{
+    while (n > 0) {
+        const unsigned long *mt;
+        int i, run;
+
+        if (state->mti >= N)
+            mt_next_state(state);
+
+        mt = state->mt + state->mti;
+        run = N - state->mti;
+        if (run > n)
+            run = n;
+
+        for (i=0; i<run; i++) {
+            /* the words fit 32 bits, four to a vector, and SSE only */
+            /* converts signed ones, so the top bit goes through the sign */
+            uint32_t y = (uint32_t)mt[i];
+            y ^= (y >> 11);
+            y ^= (y << 7) & 0x9d2c5680U;
+            y ^= (y << 15) & 0xefc60000U;
+            y ^= (y >> 18);
+            out[i] = ((double)(int32_t)(y ^ 0x80000000U) + 2147483648.0)*(1.0/4294967295.0);
+        }
+
+        state->mti += run;
+        out += run;
+        n -= run;
+    }
+}
+
+/* the original interface, on the shared state */
+
+void init_genrand(unsigned long s)
+{
+    mt_init(&global, s);
+}
+
+void init_by_array(unsigned long init_key[], int key_length)
+{
+    mt_init_by_array(&global, init_key, key_length);
+}
+
+unsigned long genrand_int32(void)
+{
+    return mt_genrand_int32(&global);
+}
+
+long genrand_int31(void)
+{
+    return mt_genrand_int31(&global);
+}
+
+double genrand_real1(void)
+{
+    return mt_genrand_real1(&global);
+}
+
+double genrand_real2(void)
+{
+    return mt_genrand_real2(&global);
+}
+
+double genrand_real3(void)
+{
+    return mt_genrand_real3(&global);
+}
+
+double genrand_res53(void)
+{
+    return mt_genrand_res53(&global);
+}
@@ -46,6 +46,15 @@
    email: m-mat @ math.sci.hiroshima-u.ac.jp (remove space)
 */
 
+#define MT_N 624
+
+/* the state of one generator, for callers that want their own */
+/* initialize it with mt_init() or mt_init_by_array() before use */
+typedef struct mt_state {
+    unsigned long mt[MT_N]; /* the array for the state vector  */
+    int mti; /* mti==MT_N+1 means mt[MT_N] is not initialized */
+} mt_state;
+
 /* initializes mt[N] with a seed */
 void init_genrand(unsigned long s);
 
@@ -74,4 +83,18 @@ double genrand_real3(void);
 /* generates a random number on [0,1) with 53-bit resolution*/
 double genrand_res53(void);
 
+/* The reentrant versions of the functions above, on an explicit state. */
+/* The functions above share one state of the same kind. */
+void mt_init(mt_state *state, unsigned long s);
+void mt_init_by_array(mt_state *state, unsigned long init_key[], int key_length);
+unsigned long mt_genrand_int32(mt_state *state);
+long mt_genrand_int31(mt_state *state);
+double mt_genrand_real1(mt_state *state);
+double mt_genrand_real2(mt_state *state);
+double mt_genrand_real3(mt_state *state);
+double mt_genrand_res53(mt_state *state);
+
+/* fills an array with the numbers mt_genrand_real1() would return */
+void mt_fill_real1(mt_state *state, double *out, int n);
+
 #endif /* MT19937AR_H */
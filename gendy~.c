@@ -1,12 +1,10 @@
 #include "m_pd.h"
 #include <math.h>
 #include <stdbool.h>
-#include <time.h>
 
+#include "br_rand.h"
 #include "bruits.h"
 
-#include "mt19937ar/mt19937ar.h"
-
 /**
  * A gendy algorithm after Xenakis
  *
@@ -16,6 +14,9 @@
 #define MAX_CONTROL_POINTS 128
 #define RAMP_TIME 0.02
 
+// uniform numbers are drawn from the generator this many at a time
+#define GENDY_UNIFORMS 64
+
 static t_class* gendy_class;
 
 // gendy definition
@@ -50,6 +51,7 @@ typedef struct _gendy {
     double nextamp;
     double dur;
     double speed;
+    uint64_t breakpoints;
 
     double ampstep1[MAX_CONTROL_POINTS];
     double ampstep2[MAX_CONTROL_POINTS];
@@ -58,8 +60,46 @@ typedef struct _gendy {
     double durstep2[MAX_CONTROL_POINTS];
 
     double isamplerate;
+
+    // every instance has its own generator, so its output only depends on
+    // its seed
+    t_br_rand rng;
+    double uniform[GENDY_UNIFORMS];
+    int nextuniform;
+
+    uint64_t instance; // the index the seed derives from
+    struct _gendy* next;
 } t_gendy;
 
+// the master seed, set with [; bruits seed N(
+static uint64_t gendy_master;
+
+// the instances by index
+static t_gendy* gendy_first;
+
+// the next number on [0,1] from the instance's generator
+static inline double gendy_random(t_gendy* x)
+{
+    if (x->nextuniform == GENDY_UNIFORMS) {
+        br_rand_fill(&x->rng, x->uniform, GENDY_UNIFORMS);
+        x->nextuniform = 0;
+    }
+
+    return x->uniform[x->nextuniform++];
+}
+
+// starts the random walks at new random points
+static void gendy_points(t_gendy* x)
+{
+    for (int i = 0; i < MAX_CONTROL_POINTS; i++) {
+        x->ampstep1[i] = 2 * gendy_random(x) - 1;
+        x->ampstep2[i] = 2 * gendy_random(x) - 1;
+
+        x->durstep1[i] = 2 * gendy_random(x) - 1;
+        x->durstep2[i] = gendy_random(x);
+    }
+}
+
 static void gendy_init(t_gendy* x)
 {
     x->knum = 12;
@@ -73,22 +113,9 @@ static void gendy_init(t_gendy* x)
     x->durscale = 0.5;
 
     // internal
-    x->phase = 1;
-    x->index = 0;
-    x->amp = 0;
-    x->nextamp = 0;
-    x->dur = 1.0;
-    x->speed = 1.0;
+    x->breakpoints = 0;
 
     x->isamplerate = 1 / sys_getsr();
-
-    for (int i = 0; i < MAX_CONTROL_POINTS; i++) {
-        x->ampstep1[i] = 2 * genrand_real1() - 1;
-        x->ampstep2[i] = 2 * genrand_real1() - 1;
-
-        x->durstep1[i] = 2 * genrand_real1() - 1;
-        x->durstep2[i] = genrand_real1();
-    }
 }
 
 static inline double mirror(double input, double lower, double upper)
@@ -149,6 +176,56 @@ static void gendy_debug(t_gendy* x)
     post("ampparam %f", x->ampparam);
     post("durscale %f", x->durscale);
     post("durparam %f", x->durparam);
+    post("breakpoints %llu", (unsigned long long)x->breakpoints);
+}
+
+// seeds the generator and starts the walks over, a seed always gives the same output
+static void gendy_reseed(t_gendy* x, uint64_t seed)
+{
+    br_rand_seed(&x->rng, seed);
+    x->nextuniform = GENDY_UNIFORMS;
+
+    x->phase = 1;
+    x->index = 0;
+    x->amp = 0;
+    x->nextamp = 0;
+    x->dur = 1.0;
+    x->speed = 1.0;
+    gendy_points(x);
+}
+
+// up to 2^24, the whole numbers that a float holds exactly
+static uint64_t gendy_seedarg(float seed)
+{
+    return (uint64_t)br_clamp(seed, 0.f, 16777216.f);
+}
+
+static void gendy_seed(t_gendy* x, float seed)
+{
+    gendy_reseed(x, gendy_seedarg(seed));
+}
+
+// --- master seed
+//
+// Every instance derives its seed from the master seed and an index, the
+// lowest that no other instance holds. A patch renders the same whenever
+// it's opened, and when it's closed and opened again in the same session it
+// gets its indices back unless other instances were created meanwhile. The
+// master seed is shared by all open patches, a new one numbers their
+// instances again from 0 in order and reseeds them.
+
+static t_class* gendy_bruits_class;
+
+static void gendy_bruits_seed(t_pd* dummy, float seed)
+{
+    (void)dummy;
+
+    gendy_master = gendy_seedarg(seed);
+    uint64_t index = 0;
+    for (t_gendy* x = gendy_first; x; x = x->next) {
+        x->instance = index++;
+        gendy_reseed(x, br_rand_derive(gendy_master, x->instance));
+    }
 }
 
 static void gendy_knum(t_gendy* x, float knum)
@@ -212,6 +289,7 @@ static t_int* gendy_perform(t_int* w)
     double amp = x->amp;
     double nextamp = x->nextamp;
     double speed = x->speed;
+    uint64_t breakpoints = x->breakpoints;
 
     for (int i = 0; i < frames; ++i) {
         double ampscale = x->ampscale;
@@ -222,6 +300,7 @@ static t_int* gendy_perform(t_int* w)
 
         if (phase >= 1) {
             phase -= 1;
+            breakpoints++;
 
             int index = x->index;
             index = (index + 1) % knum;
@@ -231,7 +310,7 @@ static t_int* gendy_perform(t_int* w)
             amp = nextamp;
 
             gendy_distro ampdist = x->ampdist;
-            double ampstep = x->ampstep1[index] + gendy_distribution(ampdist, x->ampparam, genrand_real1());
+            double ampstep = x->ampstep1[index] + gendy_distribution(ampdist, x->ampparam, gendy_random(x));
             ampstep = mirror(ampstep, -1.0, 1.0);
             x->ampstep1[index] = ampstep;
 
@@ -241,7 +320,7 @@ static t_int* gendy_perform(t_int* w)
 
             // dur
             gendy_distro durdist = x->durdist;
-            double durstep = x->durstep1[index] + gendy_distribution(durdist, x->durparam, genrand_real1());
+            double durstep = x->durstep1[index] + gendy_distribution(durdist, x->durparam, gendy_random(x));
             durstep = mirror(durstep, -1.0, 1.0);
             x->durstep1[index] = durstep;
 
@@ -264,6 +343,7 @@ static t_int* gendy_perform(t_int* w)
     x->nextamp = nextamp;
     x->speed = speed;
     x->dur = rate;
+    x->breakpoints = breakpoints;
 
     return (w + 4);
 }
@@ -279,18 +359,39 @@ static void* gendy_new(void)
     t_gendy* x = (t_gendy*)pd_new(gendy_class);
 
     gendy_init(x);
-    init_genrand(time(NULL));
+
+    // takes the first gap in the indices, which keeps the list in order
+    uint64_t index = 0;
+    t_gendy** p = &gendy_first;
+    while (*p && (*p)->instance == index) {
+        index++;
+        p = &(*p)->next;
+    }
+    x->instance = index;
+    x->next = *p;
+    *p = x;
+
+    gendy_reseed(x, br_rand_derive(gendy_master, x->instance));
 
     outlet_new(&x->x_obj, gensym("signal"));
     return (x);
 }
 
+static void gendy_free(t_gendy* x)
+{
+    t_gendy** p = &gendy_first;
+    while (*p != x)
+        p = &(*p)->next;
+    *p = x->next;
+}
+
 void gendy_tilde_setup(void)
 {
-    gendy_class = class_new(gensym("gendy~"), (t_newmethod)gendy_new, 0,
+    gendy_class = class_new(gensym("gendy~"), (t_newmethod)gendy_new, (t_method)gendy_free,
         sizeof(t_gendy), 0, A_DEFFLOAT, 0);
 
     class_addmethod(gendy_class, (t_method)gendy_debug, gensym("debug"), 0);
+    class_addmethod(gendy_class, (t_method)gendy_seed, gensym("seed"), A_FLOAT, 0);
     class_addmethod(gendy_class, (t_method)gendy_knum, gensym("knum"), A_FLOAT, 0);
     class_addmethod(gendy_class, (t_method)gendy_minfreq, gensym("minfreq"), A_FLOAT, 0);
     class_addmethod(gendy_class, (t_method)gendy_maxfreq, gensym("maxfreq"), A_FLOAT, 0);
@@ -302,4 +403,9 @@ void gendy_tilde_setup(void)
     class_addmethod(gendy_class, (t_method)gendy_durdist, gensym("durdist"), A_FLOAT, 0);
 
     class_addmethod(gendy_class, (t_method)gendy_dsp, gensym("dsp"), 0);
+
+    // receives the messages to "bruits"
+    gendy_bruits_class = class_new(gensym("bruits"), 0, 0, sizeof(t_pd), CLASS_PD, 0);
+    class_addmethod(gendy_bruits_class, (t_method)gendy_bruits_seed, gensym("seed"), A_FLOAT, 0);
+    pd_bind(pd_new(gendy_bruits_class), gensym("bruits"));
 }
@@ -0,0 +1,47 @@
+#include "attractor.h"
+
+// The Lorenz attractor
+//
+// dx = sigma (y - x), dy = x (rho - z) - y, dz = x y - beta z
+// with the input driving y
+
+static t_class* lorenz_class;
+
+static const t_attractor_param lorenz_params[] = {
+    { "sigma", 10.f, 0.f, 50.f },
+    { "rho", 28.f, 0.f, 100.f },
+    { "beta", 8.f / 3.f, 0.f, 10.f },
+};
+
+static inline void lorenz_field(const float* s, const float* p, float pert, float* slope)
+{
+    slope[0] = p[0] * (s[1] - s[0]);
+    slope[1] = s[0] * (p[1] - s[2]) - s[1] + pert;
+    slope[2] = s[0] * s[1] - p[2] * s[2];
+}
+
+static t_int* lorenz_perform(t_int* w)
+{
+    return attractor_perform(w, lorenz_field);
+}
+
+static const t_attractor_model lorenz_model = {
+    .name = "lorenz~",
+    .perform = lorenz_perform,
+    .params = lorenz_params,
+    .nparams = 3,
+    .init = { 1.f, 1.f, 20.f },
+    .bound = 100.f,
+    .scale = 1.f / 20.f,
+    .speed = 0.5f,
+};
+
+static void* lorenz_new(void)
+{
+    return attractor_new(lorenz_class, &lorenz_model);
+}
+
+void lorenz_tilde_setup(void)
+{
+    lorenz_class = attractor_class_new(&lorenz_model, (t_newmethod)lorenz_new);
+}
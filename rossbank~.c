@@ -0,0 +1,426 @@
+#include "bruits.h"
+#include "m_pd.h"
+#include "rossler.h"
+#include <math.h>
+#include <stdbool.h>
+#include <string.h>
+
+// A bank of rossler oscillators
+//
+// Every voice is a ross~ without input, integrated with the same two stage
+// step. State and parameters are kept as arrays per variable, and the voices
+// are processed in groups of ROSSBANK_LANES so that the loop over a group
+// maps onto vector instructions.
+//
+// The voices can be coupled: the x of every voice perturbs the y of the
+// others, weighted by a matrix, like the input of ross~.
+
+static const float FREQ_C4 = 261.6256f;
+
+#define ROSSBANK_LANES 8
+#define ROSSBANK_MAXVOICES 1024
+
+static t_class* rossbank_class;
+
+typedef struct _rossbank_tilde {
+    t_object x_obj;
+
+    int voices;
+    int padded; // voices rounded up to whole groups
+    bool multichannel;
+
+    // padded floats each, the voices past the last one stay at rest
+    float* xs;
+    float* ys;
+    float* zs;
+    float* a_param;
+    float* b_param;
+    float* c_param;
+    float* pitch;
+    float* dt;
+    float* pert; // of the current sample, while coupled
+
+    // padded rows of padded weights, row u holds the weights of voice u
+    // driving each of the others. Only allocated with the first couple
+    // message.
+    float* coupling;
+    bool coupled; // any weight is non zero
+
+    float sampletime;
+
+    t_outlet* x_outlet;
+} t_rossbank;
+
+// --- interface
+
+static void rossbank_update_dt(t_rossbank* x, int voice)
+{
+    float pitch = FREQ_C4 * powf(2.f, x->pitch[voice]) * 6.2831853f;
+    x->dt[voice] = x->sampletime * pitch;
+}
+
+// Parameters are set for all voices with a single value, or for one voice
+// with its index and the value: "c 8" or "c 3 8". Returns the first and one
+// past the last voice that changed.
+static bool rossbank_select(t_rossbank* x, t_symbol* s, int argc, t_atom* argv,
+    float min, float max, float* values, int* first, int* last)
+{
+    if (argc < 1 || argc > 2) {
+        pd_error(x, "rossbank~: %s expects a value or a voice and a value", s->s_name);
+        return false;
+    }
+
+    if (argc == 1) {
+        *first = 0;
+        *last = x->voices;
+    } else {
+        int voice = (int)atom_getfloat(argv);
+        if (voice < 0 || voice >= x->voices) {
+            pd_error(x, "rossbank~: no voice %d", voice);
+            return false;
+        }
+        *first = voice;
+        *last = voice + 1;
+    }
+
+    float value = atom_getfloat(argv + argc - 1);
+    value = br_clamp(value, min, max);
+    for (int v = *first; v < *last; v++)
+        values[v] = value;
+    return true;
+}
+
+static void rossbank_a(t_rossbank* x, t_symbol* s, int argc, t_atom* argv)
+{
+    int first, last;
+    rossbank_select(x, s, argc, argv, 0, 1, x->a_param, &first, &last);
+}
+
+static void rossbank_b(t_rossbank* x, t_symbol* s, int argc, t_atom* argv)
+{
+    int first, last;
+    rossbank_select(x, s, argc, argv, 0, 1, x->b_param, &first, &last);
+}
+
+static void rossbank_c(t_rossbank* x, t_symbol* s, int argc, t_atom* argv)
+{
+    int first, last;
+    rossbank_select(x, s, argc, argv, 0, 30, x->c_param, &first, &last);
+}
+
+static void rossbank_pitch(t_rossbank* x, t_symbol* s, int argc, t_atom* argv)
+{
+    int first, last;
+    if (!rossbank_select(x, s, argc, argv, -10, 10, x->pitch, &first, &last))
+        return;
+
+    for (int v = first; v < last; v++)
+        rossbank_update_dt(x, v);
+}
+
+// "couple k" drives every voice by the mean x of all others times k,
+// "couple i j k" drives voice i by the x of voice j times k
+static void rossbank_couple(t_rossbank* x, t_symbol* s, int argc, t_atom* argv)
+{
+    (void)s;
+
+    if (argc != 1 && argc != 3) {
+        pd_error(x, "rossbank~: couple expects a weight or two voices and a weight");
+        return;
+    }
+
+    int to = 0;
+    int from = 0;
+    if (argc == 3) {
+        to = (int)atom_getfloat(argv);
+        from = (int)atom_getfloat(argv + 1);
+        if (to < 0 || to >= x->voices || from < 0 || from >= x->voices) {
+            pd_error(x, "rossbank~: no voices %d and %d", to, from);
+            return;
+        }
+    }
+
+    size_t size = (size_t)x->padded * x->padded * sizeof(float);
+    if (!x->coupling)
+        x->coupling = (float*)getbytes(size);
+
+    float k = atom_getfloat(argv + argc - 1);
+    k = br_clamp(k, -10.f, 10.f);
+
+    if (argc == 3) {
+        x->coupling[from * x->padded + to] = k;
+    } else {
+        float w = x->voices > 1 ? k / (x->voices - 1) : 0.f;
+        for (int u = 0; u < x->voices; u++) {
+            for (int v = 0; v < x->voices; v++)
+                x->coupling[u * x->padded + v] = u == v ? 0.f : w;
+        }
+    }
+
+    x->coupled = false;
+    for (int i = 0; i < x->padded * x->padded; i++)
+        x->coupled = x->coupled || x->coupling[i] != 0.f;
+}
+
+// --- DSP
+
+// one step of a group of voices, the same as ross~'s heun step
+static inline void rossbank_step(float* restrict sx, float* restrict sy, float* restrict sz,
+    const float* restrict A, const float* restrict B, const float* restrict C,
+    const float* restrict half, const float* restrict pert, const bool coupled)
+{
+    for (int l = 0; l < ROSSBANK_LANES; l++) {
+        float k1[3];
+        float k2[3];
+        float p = coupled ? pert[l] : 0.f;
+        rossler_slope(sx[l], sy[l], sz[l], A[l], B[l], C[l], p, k1);
+        rossler_slope(sx[l] + k1[0] * half[l], sy[l] + k1[1] * half[l], sz[l] + k1[2] * half[l],
+            A[l], B[l], C[l], p, k2);
+
+        sx[l] += (k1[0] + k2[0]) * half[l];
+        sy[l] += (k1[1] + k2[1]) * half[l];
+        sz[l] += (k1[2] + k2[2]) * half[l];
+
+        sx[l] = br_clamp(sx[l], -20.f, 20.f);
+        sy[l] = br_clamp(sy[l], -20.f, 20.f);
+        sz[l] = br_clamp(sz[l], -20.f, 20.f);
+    }
+}
+
+// Coupled voices depend on each other's last x, so all groups advance
+// sample by sample and their state goes through the arrays. The perturbations
+// are accumulated one driving voice at a time, so that the inner loop runs
+// over the driven voices in vector instructions without a horizontal sum.
+static void rossbank_perform_coupled(t_rossbank* x, int frames, t_sample* restrict out,
+    float scale)
+{
+    int padded = x->padded;
+    const float* restrict coupling = x->coupling;
+    float* restrict xs = x->xs;
+    float* restrict pert = x->pert;
+
+    for (int i = 0; i < frames; i++) {
+        memset(pert, 0, padded * sizeof(float));
+        for (int u = 0; u < x->voices; u++) {
+            const float* restrict row = coupling + (size_t)u * padded;
+            float xu = xs[u];
+            for (int v = 0; v < padded; v++)
+                pert[v] += row[v] * xu;
+        }
+
+        float sum = 0.f;
+        for (int g = 0; g < padded; g += ROSSBANK_LANES) {
+            float sx[ROSSBANK_LANES];
+            float sy[ROSSBANK_LANES];
+            float sz[ROSSBANK_LANES];
+            float A[ROSSBANK_LANES];
+            float B[ROSSBANK_LANES];
+            float C[ROSSBANK_LANES];
+            float half[ROSSBANK_LANES];
+
+            for (int l = 0; l < ROSSBANK_LANES; l++) {
+                sx[l] = xs[g + l];
+                sy[l] = x->ys[g + l];
+                sz[l] = x->zs[g + l];
+                A[l] = x->a_param[g + l];
+                B[l] = x->b_param[g + l];
+                C[l] = x->c_param[g + l];
+                half[l] = x->dt[g + l] * 0.5f;
+            }
+
+            rossbank_step(sx, sy, sz, A, B, C, half, pert + g, true);
+
+            for (int l = 0; l < ROSSBANK_LANES; l++) {
+                xs[g + l] = sx[l];
+                x->ys[g + l] = sy[l];
+                x->zs[g + l] = sz[l];
+                sum += sx[l];
+            }
+        }
+
+        if (x->multichannel) {
+            for (int v = 0; v < x->voices; v++)
+                out[(size_t)v * frames + i] = xs[v] / 3.0f;
+        } else
+            out[i] = sum * scale;
+    }
+}
+
+// The groups are rendered one after another, each keeps its state in locals
+// for the whole block. The sum is scaled to the level of a single voice.
+static t_int* rossbank_perform(t_int* w)
+{
+    t_rossbank* x = (t_rossbank*)(w[1]);
+    int frames = (int)w[2];
+    t_sample* restrict out = (t_sample*)w[3];
+
+    float scale = 1.f / (3.f * x->voices);
+
+    if (x->coupled) {
+        rossbank_perform_coupled(x, frames, out, scale);
+        return (w + 4);
+    }
+
+    if (!x->multichannel)
+        memset(out, 0, frames * sizeof(t_sample));
+
+    for (int g = 0; g < x->padded; g += ROSSBANK_LANES) {
+        float sx[ROSSBANK_LANES];
+        float sy[ROSSBANK_LANES];
+        float sz[ROSSBANK_LANES];
+        float A[ROSSBANK_LANES];
+        float B[ROSSBANK_LANES];
+        float C[ROSSBANK_LANES];
+        float half[ROSSBANK_LANES];
+
+        for (int l = 0; l < ROSSBANK_LANES; l++) {
+            sx[l] = x->xs[g + l];
+            sy[l] = x->ys[g + l];
+            sz[l] = x->zs[g + l];
+            A[l] = x->a_param[g + l];
+            B[l] = x->b_param[g + l];
+            C[l] = x->c_param[g + l];
+            half[l] = x->dt[g + l] * 0.5f;
+        }
+
+        if (x->multichannel) {
+            // only the channels of actual voices exist
+            int lanes = br_minimum(x->voices - g, ROSSBANK_LANES);
+            t_sample* chan = out + (size_t)g * frames;
+
+            for (int i = 0; i < frames; i++) {
+                rossbank_step(sx, sy, sz, A, B, C, half, 0, false);
+                for (int l = 0; l < lanes; l++)
+                    chan[l * frames + i] = sx[l] / 3.0f;
+            }
+        } else {
+            for (int i = 0; i < frames; i++) {
+                rossbank_step(sx, sy, sz, A, B, C, half, 0, false);
+
+                float sum = 0.f;
+                for (int l = 0; l < ROSSBANK_LANES; l++)
+                    sum += sx[l];
+                out[i] += sum * scale;
+            }
+        }
+
+        for (int l = 0; l < ROSSBANK_LANES; l++) {
+            x->xs[g + l] = sx[l];
+            x->ys[g + l] = sy[l];
+            x->zs[g + l] = sz[l];
+        }
+    }
+
+    return (w + 4);
+}
+
+static void rossbank_dsp(t_rossbank* x, t_signal** sp)
+{
+#ifdef CLASS_MULTICHANNEL
+    signal_setmultiout(&sp[0], x->multichannel ? x->voices : 1);
+#endif
+
+    x->sampletime = 1.f / sp[0]->s_sr;
+    for (int v = 0; v < x->voices; v++)
+        rossbank_update_dt(x, v);
+
+    dsp_add(rossbank_perform, 3, x, sp[0]->s_n, sp[0]->s_vec);
+}
+
+// --- init
+
+static void rossbank_reset(t_rossbank* x)
+{
+    for (int v = 0; v < x->voices; v++) {
+        x->xs[v] = 0.f;
+        x->ys[v] = 5.f;
+        x->zs[v] = 0.f;
+
+        x->a_param[v] = 0.2;
+        x->b_param[v] = 0.2;
+        x->c_param[v] = 5.7;
+        x->pitch[v] = 0;
+
+        rossbank_update_dt(x, v);
+    }
+
+    if (x->coupling)
+        memset(x->coupling, 0, (size_t)x->padded * x->padded * sizeof(float));
+    x->coupled = false;
+}
+
+// rossbank~ [-mc] [voices]
+static void* rossbank_new(t_symbol* s, int argc, t_atom* argv)
+{
+    (void)s;
+
+    t_rossbank* x = (t_rossbank*)pd_new(rossbank_class);
+    float voices = 8;
+
+    for (int i = 0; i < argc; i++) {
+        if (argv[i].a_type == A_FLOAT) {
+            voices = atom_getfloat(argv + i);
+            continue;
+        }
+
+        t_symbol* flag = atom_getsymbol(argv + i);
+        if (flag == gensym("-mc")) {
+#ifdef CLASS_MULTICHANNEL
+            x->multichannel = true;
+#else
+            pd_error(x, "rossbank~: -mc needs Pd 0.54 or later, summing the voices");
+#endif
+        } else
+            pd_error(x, "rossbank~: unknown argument %s (-mc)", flag->s_name);
+    }
+
+    if (!(voices >= 1 && voices <= ROSSBANK_MAXVOICES)) {
+        voices = br_clamp(voices, 1.f, (float)ROSSBANK_MAXVOICES);
+        pd_error(x, "rossbank~: voices expects 1 to %d, using %d", ROSSBANK_MAXVOICES, (int)voices);
+    }
+    x->voices = (int)voices;
+    x->padded = (x->voices + ROSSBANK_LANES - 1) / ROSSBANK_LANES * ROSSBANK_LANES;
+
+    float* mem = (float*)getbytes(9 * x->padded * sizeof(float));
+    float** arrays[] = { &x->xs, &x->ys, &x->zs, &x->a_param, &x->b_param, &x->c_param,
+        &x->pitch, &x->dt, &x->pert };
+    for (int i = 0; i < 9; i++)
+        *arrays[i] = mem + i * x->padded;
+
+    x->sampletime = 1.f / sys_getsr();
+    rossbank_reset(x);
+
+    x->x_outlet = outlet_new(&x->x_obj, &s_signal);
+
+    return (void*)x;
+}
+
+static void* rossbank_free(t_rossbank* x)
+{
+    freebytes(x->xs, 9 * x->padded * sizeof(float));
+    if (x->coupling)
+        freebytes(x->coupling, (size_t)x->padded * x->padded * sizeof(float));
+    outlet_free(x->x_outlet);
+    return (void*)x;
+}
+
+void rossbank_tilde_setup(void)
+{
+    int flags = CLASS_DEFAULT;
+#ifdef CLASS_MULTICHANNEL
+    flags |= CLASS_MULTICHANNEL;
+#endif
+
+    // through t_method, which any function pointer converts to without a warning
+    rossbank_class = class_new(gensym("rossbank~"), (t_newmethod)(t_method)rossbank_new, (t_method)rossbank_free,
+        sizeof(t_rossbank), flags, A_GIMME, 0);
+
+    class_addmethod(rossbank_class, (t_method)rossbank_dsp, gensym("dsp"), A_CANT, 0);
+
+    class_addmethod(rossbank_class, (t_method)rossbank_reset, gensym("reset"), 0);
+    class_addmethod(rossbank_class, (t_method)rossbank_a, gensym("a"), A_GIMME, 0);
+    class_addmethod(rossbank_class, (t_method)rossbank_b, gensym("b"), A_GIMME, 0);
+    class_addmethod(rossbank_class, (t_method)rossbank_c, gensym("c"), A_GIMME, 0);
+    class_addmethod(rossbank_class, (t_method)rossbank_pitch, gensym("pitch"), A_GIMME, 0);
+    class_addmethod(rossbank_class, (t_method)rossbank_couple, gensym("couple"), A_GIMME, 0);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+// The rossler system, shared by ross~ and rossbank~
+
+static inline void rossler_slope(float x, float y, float z, float a, float b, float c, float pert, float* output)
+{
+    output[0] = -y - z;
+    output[1] = x + a * y + pert;
+    output[2] = b + z * (x - c);
+}
+
+// in double, for ross~ -double
+static inline void rossler_slope_double(double x, double y, double z, double a, double b, double c,
+    double pert, double* output)
+{
+    output[0] = -y - z;
+    output[1] = x + a * y + pert;
+    output[2] = b + z * (x - c);
+}
+
+// as an attractor field, with the parameters a, b and c in p
+static inline void rossler_field(const float* s, const float* p, float pert, float* slope)
+{
+    rossler_slope(s[0], s[1], s[2], p[0], p[1], p[2], pert, slope);
+}
@@ -1,6 +1,9 @@
+#include "attractor_step.h"
 #include "bruits.h"
 #include "m_pd.h"
+#include "rossler.h"
 #include <math.h>
+#include <stdbool.h>
 
 // A rossler chaotic attractor
 //
@@ -11,6 +14,79 @@ static const float FREQ_C4 = 261.6256f;
 
 static t_class* ross_class;
 
+typedef enum ross_integrator {
+    ross_euler = 0,
+    ross_heun,
+    ross_rk4,
+    ross_semi,
+    ross_dopri,
+    ross_integrators,
+} ross_integrator;
+
+static const char* ross_integrator_names[ross_integrators] = { "euler", "heun", "rk4", "semi", "dopri" };
+
+// error tolerances and the longest step of the adaptive integrator, steps
+// never get shorter than a sample divided by ROSS_DOPRI_MAXSTEPS
+#define ROSS_DOPRI_RTOL 1e-4f
+#define ROSS_DOPRI_ATOL 1e-4f
+#define ROSS_DOPRI_HMAX 0.5f
+#define ROSS_DOPRI_MAXSTEPS 64
+
+// Dormand–Prince steps are decoupled from the output samples, which are
+// interpolated from the current step
+typedef struct _ross_dopri {
+    float y[3]; // state at the end of the current step
+    float k1[3]; // slope at y
+    float cont[5][3]; // dense output of the current step
+    float span; // length of the current step
+    float tau; // time of the last output inside the current step
+    float h; // next step size to try
+    int clamped; // steps that left the clamp range
+    bool nonfinite; // a step went to NaN or infinity
+    bool restart;
+} t_ross_dopri;
+
+// the longest window and settling time of the orbit cache, in seconds
+#define ROSS_CACHE_MAXTIME 10.f
+
+typedef enum ross_cache_phase {
+    ross_cache_settling = 0,
+    ross_cache_recording,
+    ross_cache_playing,
+} ross_cache_phase;
+
+// A window of the trajectory, recorded once the parameters held still for
+// the settling time and then looped instead of integrated
+typedef struct _ross_cache {
+    float* table; // x, y and z of every sample of the window
+    int length; // of the window in samples, 0 without a cache
+    int fade; // samples at the end of the window that crossfade into its start
+    int pos;
+    int settled; // samples integrated without a change of the parameters
+    ross_cache_phase phase;
+    float key[5]; // the coefficients, step and integrator of the window
+} t_ross_cache;
+
+// The parameters set by messages, which ramp to a new value when a ramp
+// time is set and dsp is running
+enum {
+    ross_ramp_a = 0,
+    ross_ramp_b,
+    ross_ramp_c,
+    ross_ramp_pitch,
+    ross_ramp_mix,
+    ross_ramp_gain,
+    ross_ramps,
+};
+
+// a linear ramp of a parameter, advanced once per block
+typedef struct _ross_ramp {
+    float* value;
+    float target;
+    float step;
+    int blocks; // left until the target is reached
+} t_ross_ramp;
+
 typedef struct _ross_tilde {
     t_object x_obj;
 
@@ -22,106 +98,1016 @@ typedef struct _ross_tilde {
     float b_param;
     float c_param;
 
-    float xout;
-    float yout;
-    float zout;
+    // the coefficients of the current block, with the constant inlets added
+    float A;
+    float B;
+    float C;
+
+    // x, y and z, in double for the instances that integrate in double.
+    // The float kernels round it once per block, which loses nothing.
+    double state[3];
+    float initial[3]; // the state after a reset
+    bool precise;
 
     float sampletime;
+    float dt;
+
+    // the pitch inlet: its value while constant, otherwise the step of every
+    // sample of the block
+    float pitchin;
+    float* dts;
+
+    // the a, b and c of every sample of the block while an inlet is modulated
+    float* abcs;
+
+    float* buffers; // dts and abcs
+    t_sample* recorded; // x, y and z of the samples the cache records
+    int nbuffers;
+    ross_integrator integrator;
+    t_ross_dopri dopri;
+
+    float yzscale; // of the y and z outlets
+
+    float ramptime; // in ms, 0 sets the parameters right away
+    t_ross_ramp ramps[ross_ramps];
+    bool ramping; // any ramp is active
+
+    // samples that left the clamp range in the current block, and since the
+    // last stats message with the blocks that diverged
+    int clamped;
+    bool nonfinite; // the state went to NaN or infinity in the current block
+    int clamps;
+    int diverged;
+    int resets;
+    bool autoreset; // start over from the initial state on divergence
+
+    float cachetime; // the length of the cached window in seconds, 0 is off
+    float cachesettle; // in seconds
+    t_ross_cache cache;
 
     t_outlet* x_outlet;
+    t_outlet* y_outlet;
+    t_outlet* z_outlet;
+    t_outlet* state_outlet; // x y z for the state message
 } t_ross;
 
 // --- interface
 
+// Sets a parameter, or starts a ramp to the value over the ramp time.
+// Until dsp has been set up the block size is unknown and the parameters
+// are set right away, as they are by a loadbang.
+static void ross_ramp_to(t_ross* x, int param, float value)
+{
+    t_ross_ramp* r = &x->ramps[param];
+
+    int blocks = 0;
+    if (x->nbuffers > 0)
+        blocks = (int)ceilf(x->ramptime * 0.001f / (x->sampletime * x->nbuffers));
+
+    if (blocks < 1) {
+        *r->value = value;
+        r->blocks = 0;
+        return;
+    }
+
+    r->target = value;
+    r->step = (value - *r->value) / blocks;
+    r->blocks = blocks;
+    x->ramping = true;
+}
+
+// the time in ms that the parameters take to reach a new value
+static void ross_ramp(t_ross* x, float ms)
+{
+    x->ramptime = br_clamp(ms, 0.f, 10000.f);
+}
+
 static void ross_a(t_ross* x, float a)
 {
-    x->a_param = br_clamp(a, 0, 1);
+    ross_ramp_to(x, ross_ramp_a, br_clamp(a, 0, 1));
 }
 
 static void ross_b(t_ross* x, float b)
 {
-    x->b_param = br_clamp(b, 0, 1);
+    ross_ramp_to(x, ross_ramp_b, br_clamp(b, 0, 1));
 }
 
 static void ross_c(t_ross* x, float c)
 {
-    x->c_param = br_clamp(c, 0, 30);
+    ross_ramp_to(x, ross_ramp_c, br_clamp(c, 0, 30));
+}
+
+// pitch is in octaves above C4, the integration step per sample follows
+// from it, the pitch inlet and the sample rate and is only recomputed when
+// one of them changes
+static void ross_update_dt(t_ross* x)
+{
+    float octaves = x->pitch + x->pitchin;
+    octaves = br_clamp(octaves, -10, 10);
+    float pitch = FREQ_C4 * powf(2.f, octaves) * 6.2831853f;
+    x->dt = x->sampletime * pitch;
 }
 
 static void ross_pitch(t_ross* x, float pitch)
 {
-    x->pitch = br_clamp(pitch, -10, 10);
+    ross_ramp_to(x, ross_ramp_pitch, br_clamp(pitch, -10, 10));
+    ross_update_dt(x);
 }
 
 static void ross_mix(t_ross* x, float mix)
 {
-    x->mix = br_clamp(mix, 0.f, 1.f);
+    ross_ramp_to(x, ross_ramp_mix, br_clamp(mix, 0.f, 1.f));
 }
 
 static void ross_gain(t_ross* x, float gain)
 {
-    x->gain = br_clamp(gain, 0.f, 10.f);
+    ross_ramp_to(x, ross_ramp_gain, br_clamp(gain, 0.f, 10.f));
+}
+
+// Moves the ramping parameters one block on. The kernels read the
+// parameters once per block, so they stay the same while nothing ramps.
+static void ross_ramp_block(t_ross* x)
+{
+    bool ramping = false;
+
+    for (int j = 0; j < ross_ramps; j++) {
+        t_ross_ramp* r = &x->ramps[j];
+        if (r->blocks == 0)
+            continue;
+
+        r->blocks--;
+        *r->value = r->blocks ? *r->value + r->step : r->target;
+        ramping = ramping || r->blocks > 0;
+    }
+
+    ross_update_dt(x);
+    x->ramping = ramping;
+}
+
+// the adaptive integrator continues from the current state
+static void ross_dopri_restart(t_ross* x)
+{
+    x->dopri.restart = true;
+}
+
+// the initial condition, which reset returns to
+static void ross_initial_state(t_ross* x)
+{
+    for (int j = 0; j < 3; j++)
+        x->state[j] = x->initial[j];
+    ross_dopri_restart(x);
 }
+
+// Outputs x, y and z as a list on the rightmost outlet, for restore. The
+// atoms are floats, an instance with -double continues from its state
+// rounded to float.
+static void ross_state(t_ross* x)
+{
+    t_atom atoms[3];
+    for (int j = 0; j < 3; j++)
+        SETFLOAT(atoms + j, (t_float)x->state[j]);
+    outlet_list(x->state_outlet, &s_list, 3, atoms);
+}
+
+// posts and clears the counters of the clamp and of diverged blocks
+static void ross_stats(t_ross* x)
+{
+    post("ross~: %d samples clamped, %d blocks diverged, %d resets", x->clamps, x->diverged,
+        x->resets);
+    x->clamps = 0;
+    x->diverged = 0;
+    x->resets = 0;
+}
+
+// starts over from the initial condition when a block diverges
+static void ross_autoreset(t_ross* x, float on)
+{
+    x->autoreset = on != 0;
+}
+
+static void ross_integrator_set(t_ross* x, t_symbol* name)
+{
+    for (int i = 0; i < ross_integrators; i++) {
+        if (name == gensym(ross_integrator_names[i])) {
+            x->integrator = (ross_integrator)i;
+            ross_dopri_restart(x);
+            return;
+        }
+    }
+
+    pd_error(x, "ross~: unknown integrator %s (euler, heun, rk4, semi, dopri)", name->s_name);
+}
+
 // --- DSP
 
-static void rossler_slope(float x, float y, float z, float a, float b, float c, float pert, float* output)
+// Advances the state s by one step of size h, pert is held over the step.
+//
+// euler, heun and rk4 are the attractors' fixed step integrators. semi is a
+// semi-implicit Euler step: each variable uses the ones already updated and
+// the decaying part of z's linear term is taken implicitly.
+static inline void ross_step(const ross_integrator integrator, float* s, float h,
+    float A, float B, float C, float pert)
 {
-    output[0] = -y - z;
-    output[1] = x + a * y + pert;
-    output[2] = b + z * (x - c);
+    const float p[3] = { A, B, C };
+
+    switch (integrator) {
+    case ross_euler:
+        attractor_step(attractor_euler, rossler_field, s, h, p, pert);
+        break;
+
+    case ross_heun:
+        attractor_step(attractor_heun, rossler_field, s, h, p, pert);
+        break;
+
+    case ross_rk4:
+        attractor_step(attractor_rk4, rossler_field, s, h, p, pert);
+        break;
+
+    case ross_semi: {
+        s[0] += (-s[1] - s[2]) * h;
+        s[1] += (s[0] + A * s[1] + pert) * h;
+
+        float d = s[0] - C;
+        s[2] = (s[2] * (1.f + h * br_maximum(d, 0.f)) + B * h) / (1.f - h * br_minimum(d, 0.f));
+        break;
+    }
+
+    default:
+        break;
+    }
 }
 
-static t_int* ross_perform(t_int* w)
+// clamps the state to +-20, returns whether it had left that range
+static inline int ross_clamp(float* s)
 {
-    t_ross* x = (t_ross*)(w[1]);
-    int frames = w[2];
-    t_sample* extin = (t_sample*)w[3];
-    t_sample* out = (t_sample*)w[4];
+    int hit = 0;
+    for (int j = 0; j < 3; j++) {
+        float v = br_clamp(s[j], -20.f, 20.f);
+        hit |= v != s[j];
+        s[j] = v;
+    }
+    return hit;
+}
+
+// The state lives in locals for the whole block and is written back once,
+// the buffers are restrict so that stores to out can't alias it. Pd may pass
+// the same vector for in and out, which is fine as every sample is read
+// before it is written.
+//
+// Every combination of integrator and input gets its own copy of the loop,
+// the y and z outlets only add a well predicted branch.
+static inline void ross_kernel(t_ross* x, int frames, const t_sample* restrict extin,
+    t_sample* restrict out, t_sample* restrict yout, t_sample* restrict zout,
+    const float* restrict dts, const float* restrict abcs, const ross_integrator integrator,
+    const bool external)
+{
+    float gain = x->gain;
+    float mix = x->mix;
+
+    float A = x->A;
+    float B = x->B;
+    float C = x->C;
+
+    float dt = x->dt;
+    float yzscale = x->yzscale;
+
+    float s[3] = { x->state[0], x->state[1], x->state[2] };
+    int clamped = 0;
+    bool finite = true;
+
+    for (int i = 0; i < frames; i++) {
+        float ext = external ? extin[i] : 0.f;
+        float pert = external ? ext * gain : 0.f;
+
+        if (abcs) {
+            A = abcs[i];
+            B = abcs[frames + i];
+            C = abcs[2 * frames + i];
+        }
+
+        ross_step(integrator, s, dts ? dts[i] : dt, A, B, C, pert);
+
+        // before the clamp, which turns a NaN into one of its bounds with
+        // SSE's minss and maxss
+        finite &= br_finite(s[0] + s[1] + s[2]);
+        clamped += ross_clamp(s);
+
+        out[i] = external ? s[0] / 3.0f * (1 - mix) + mix * ext : s[0] / 3.0f * (1 - mix);
+        if (yout) {
+            yout[i] = s[1] * yzscale;
+            zout[i] = s[2] * yzscale;
+        }
+    }
+
+    for (int j = 0; j < 3; j++)
+        x->state[j] = s[j];
+    x->clamped += clamped;
+    x->nonfinite |= !finite;
+}
+
+// ross_step in double, for the instances created with -double. At a low
+// pitch the change of the state in one step is close to its float rounding,
+// and the trajectory drifts or stalls.
+static inline void ross_step_double(const ross_integrator integrator, double* s, double h,
+    double A, double B, double C, double pert)
+{
+    double k1[3];
+    double k2[3];
+    double k3[3];
+    double k4[3];
+    double half = h * 0.5;
+
+    switch (integrator) {
+    case ross_euler:
+        rossler_slope_double(s[0], s[1], s[2], A, B, C, pert, k1);
+
+        for (int j = 0; j < 3; j++)
+            s[j] += k1[j] * h;
+        break;
+
+    case ross_heun:
+        rossler_slope_double(s[0], s[1], s[2], A, B, C, pert, k1);
+        rossler_slope_double(s[0] + k1[0] * half, s[1] + k1[1] * half, s[2] + k1[2] * half,
+            A, B, C, pert, k2);
+
+        for (int j = 0; j < 3; j++)
+            s[j] += (k1[j] + k2[j]) * half;
+        break;
+
+    case ross_rk4:
+        rossler_slope_double(s[0], s[1], s[2], A, B, C, pert, k1);
+        rossler_slope_double(s[0] + k1[0] * half, s[1] + k1[1] * half, s[2] + k1[2] * half,
+            A, B, C, pert, k2);
+        rossler_slope_double(s[0] + k2[0] * half, s[1] + k2[1] * half, s[2] + k2[2] * half,
+            A, B, C, pert, k3);
+        rossler_slope_double(s[0] + k3[0] * h, s[1] + k3[1] * h, s[2] + k3[2] * h,
+            A, B, C, pert, k4);
+
+        for (int j = 0; j < 3; j++)
+            s[j] += (k1[j] + 2. * (k2[j] + k3[j]) + k4[j]) * (h / 6.);
+        break;
+
+    case ross_semi: {
+        s[0] += (-s[1] - s[2]) * h;
+        s[1] += (s[0] + A * s[1] + pert) * h;
+
+        double d = s[0] - C;
+        s[2] = (s[2] * (1. + h * br_maximum(d, 0.)) + B * h) / (1. - h * br_minimum(d, 0.));
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+static inline int ross_clamp_double(double* s)
+{
+    int hit = 0;
+    for (int j = 0; j < 3; j++) {
+        double v = br_clamp(s[j], -20., 20.);
+        hit |= v != s[j];
+        s[j] = v;
+    }
+    return hit;
+}
+
+// ross_kernel with the state and the step in double, the output is
+// rounded to float.
+static inline void ross_kernel_double(t_ross* x, int frames, const t_sample* restrict extin,
+    t_sample* restrict out, t_sample* restrict yout, t_sample* restrict zout,
+    const float* restrict dts, const float* restrict abcs, const ross_integrator integrator,
+    const bool external)
+{
+    double gain = x->gain;
+    double mix = x->mix;
+
+    double A = x->A;
+    double B = x->B;
+    double C = x->C;
+
+    double dt = x->dt;
+    double yzscale = x->yzscale;
+
+    double s[3] = { x->state[0], x->state[1], x->state[2] };
+    int clamped = 0;
+    bool finite = true;
+
+    for (int i = 0; i < frames; i++) {
+        double ext = external ? extin[i] : 0.;
+        double pert = external ? ext * gain : 0.;
+
+        if (abcs) {
+            A = abcs[i];
+            B = abcs[frames + i];
+            C = abcs[2 * frames + i];
+        }
+
+        ross_step_double(integrator, s, dts ? dts[i] : dt, A, B, C, pert);
+        finite &= br_finite((float)(s[0] + s[1] + s[2]));
+        clamped += ross_clamp_double(s);
+
+        out[i] = external ? s[0] / 3.0 * (1 - mix) + mix * ext : s[0] / 3.0 * (1 - mix);
+        if (yout) {
+            yout[i] = s[1] * yzscale;
+            zout[i] = s[2] * yzscale;
+        }
+    }
+
+    for (int j = 0; j < 3; j++)
+        x->state[j] = s[j];
+    x->clamped += clamped;
+    x->nonfinite |= !finite;
+}
+
+// An unconnected inlet gets a block of zeros, as does a silent input.
+// Either way only the dry part of the mix remains.
+static bool ross_silent(const t_sample* in, int frames)
+{
+    for (int i = 0; i < frames; i++) {
+        if (in[i] != 0)
+            return false;
+    }
+    return true;
+}
+
+static inline void ross_run(t_ross* x, int frames, const t_sample* extin, t_sample* out,
+    t_sample* yout, t_sample* zout, const float* dts, const float* abcs,
+    const ross_integrator integrator)
+{
+    // without gain and mix the input can't reach the output, and without a
+    // signal there is nothing to mix in
+    bool external = !(x->gain == 0 && x->mix == 0) && !ross_silent(extin, frames);
+
+    if (x->precise) {
+        if (external)
+            ross_kernel_double(x, frames, extin, out, yout, zout, dts, abcs, integrator, true);
+        else
+            ross_kernel_double(x, frames, extin, out, yout, zout, dts, abcs, integrator, false);
+    } else {
+        if (external)
+            ross_kernel(x, frames, extin, out, yout, zout, dts, abcs, integrator, true);
+        else
+            ross_kernel(x, frames, extin, out, yout, zout, dts, abcs, integrator, false);
+    }
+}
+
+// Tries a Dormand–Prince 5(4) step of size h from y with slope k1. Returns
+// the scaled error norm, the new state, its slope and the coefficients of
+// the dense output.
+static float ross_dopri_try(const float* y, const float* k1, float h,
+    float A, float B, float C, float pert, float* ynew, float* k7, float (*cont)[3])
+{
+    float k2[3], k3[3], k4[3], k5[3], k6[3];
+    float t[3];
+
+    for (int j = 0; j < 3; j++)
+        t[j] = y[j] + h * (1.f / 5.f) * k1[j];
+    rossler_slope(t[0], t[1], t[2], A, B, C, pert, k2);
+
+    for (int j = 0; j < 3; j++)
+        t[j] = y[j] + h * ((3.f / 40.f) * k1[j] + (9.f / 40.f) * k2[j]);
+    rossler_slope(t[0], t[1], t[2], A, B, C, pert, k3);
+
+    for (int j = 0; j < 3; j++)
+        t[j] = y[j] + h * ((44.f / 45.f) * k1[j] - (56.f / 15.f) * k2[j] + (32.f / 9.f) * k3[j]);
+    rossler_slope(t[0], t[1], t[2], A, B, C, pert, k4);
+
+    for (int j = 0; j < 3; j++) {
+        t[j] = y[j]
+            + h * ((19372.f / 6561.f) * k1[j] - (25360.f / 2187.f) * k2[j] + (64448.f / 6561.f) * k3[j] - (212.f / 729.f) * k4[j]);
+    }
+    rossler_slope(t[0], t[1], t[2], A, B, C, pert, k5);
+
+    for (int j = 0; j < 3; j++) {
+        t[j] = y[j]
+            + h * ((9017.f / 3168.f) * k1[j] - (355.f / 33.f) * k2[j] + (46732.f / 5247.f) * k3[j] + (49.f / 176.f) * k4[j] - (5103.f / 18656.f) * k5[j]);
+    }
+    rossler_slope(t[0], t[1], t[2], A, B, C, pert, k6);
+
+    for (int j = 0; j < 3; j++) {
+        ynew[j] = y[j]
+            + h * ((35.f / 384.f) * k1[j] + (500.f / 1113.f) * k3[j] + (125.f / 192.f) * k4[j] - (2187.f / 6784.f) * k5[j] + (11.f / 84.f) * k6[j]);
+    }
+    rossler_slope(ynew[0], ynew[1], ynew[2], A, B, C, pert, k7);
+
+    float err = 0.f;
+    for (int j = 0; j < 3; j++) {
+        float e = h
+            * ((71.f / 57600.f) * k1[j] - (71.f / 16695.f) * k3[j] + (71.f / 1920.f) * k4[j] - (17253.f / 339200.f) * k5[j] + (22.f / 525.f) * k6[j] - (1.f / 40.f) * k7[j]);
+        float sc = ROSS_DOPRI_ATOL + ROSS_DOPRI_RTOL * br_maximum(fabsf(y[j]), fabsf(ynew[j]));
+        err += (e / sc) * (e / sc);
+    }
+
+    for (int j = 0; j < 3; j++) {
+        float dy = ynew[j] - y[j];
+        float bspl = h * k1[j] - dy;
+        cont[0][j] = y[j];
+        cont[1][j] = dy;
+        cont[2][j] = bspl;
+        cont[3][j] = dy - h * k7[j] - bspl;
+        cont[4][j] = h
+            * ((-12715105075.f / 11282082432.f) * k1[j] + (87487479700.f / 32700410799.f) * k3[j] - (10690763975.f / 1880347072.f) * k4[j]
+                + (701980252875.f / 199316789632.f) * k5[j] - (1453857185.f / 822651844.f) * k6[j] + (69997945.f / 29380423.f) * k7[j]);
+    }
+
+    return sqrtf(err / 3.f);
+}
+
+// Takes one step of at most h, shrinking it until the error is within the
+// tolerances, and moves on to its end.
+static void ross_dopri_step(t_ross_dopri* d, float h, float hmin,
+    float A, float B, float C, float pert)
+{
+    float ynew[3];
+    float k7[3];
+    float cont[5][3];
+
+    for (int tries = 0;; tries++) {
+        float err = ross_dopri_try(d->y, d->k1, h, A, B, C, pert, ynew, k7, cont);
+        float fac = 0.9f * powf(err, -0.2f);
+        fac = br_clamp(fac, 0.2f, 5.f);
+
+        if (err <= 1.f || h <= hmin || tries == ROSS_DOPRI_MAXSTEPS) {
+            d->h = h * br_maximum(fac, 1.f);
+            break;
+        }
+
+        h = br_maximum(h * fac, hmin);
+    }
+
+    d->nonfinite |= !br_finite(ynew[0] + ynew[1] + ynew[2]);
+
+    bool clamped = false;
+    for (int j = 0; j < 3; j++) {
+        d->y[j] = br_clamp(ynew[j], -20.f, 20.f);
+        clamped |= d->y[j] != ynew[j];
+        d->k1[j] = k7[j];
+        for (int c = 0; c < 5; c++)
+            d->cont[c][j] = cont[c][j];
+    }
+    d->span = h;
+
+    // the next step has to start from the slope of the clamped state
+    d->clamped += clamped;
+    if (clamped)
+        rossler_slope(d->y[0], d->y[1], d->y[2], A, B, C, pert, d->k1);
+}
 
+// Steps on until the current step covers tau. Bounded, so that a diverging
+// state can't stall the audio thread.
+static void ross_dopri_advance(t_ross_dopri* d, float hmin, float A, float B, float C,
+    float pert, bool driven)
+{
+    for (int steps = 0; d->tau > d->span; steps++) {
+        if (steps == 2 * ROSS_DOPRI_MAXSTEPS) {
+            d->tau = d->span;
+            break;
+        }
+
+        d->tau -= d->span;
+
+        if (driven)
+            rossler_slope(d->y[0], d->y[1], d->y[2], A, B, C, pert, d->k1);
+
+        float h = br_clamp(d->h, hmin, ROSS_DOPRI_HMAX);
+        if (driven)
+            h = br_minimum(h, d->tau);
+
+        ross_dopri_step(d, h, hmin, A, B, C, pert);
+    }
+}
+
+// Error controlled integration: as many steps as needed between two output
+// samples when the trajectory bends sharply, and steps spanning many
+// samples when it is smooth. The input and the coefficients can only change
+// at sample boundaries, so when they do no step crosses one.
+//
+// The steps outweigh everything else here, so there is only one copy of the
+// loop.
+static void ross_kernel_dopri(t_ross* x, int frames, const t_sample* restrict extin,
+    t_sample* restrict out, t_sample* restrict yout, t_sample* restrict zout,
+    const float* restrict dts, const float* restrict abcs)
+{
     float gain = x->gain;
     float mix = x->mix;
+    bool external = !(gain == 0 && mix == 0) && !ross_silent(extin, frames);
+    bool driven = (external && gain != 0) || abcs;
+
+    float A = x->A;
+    float B = x->B;
+    float C = x->C;
+
+    float dt = x->dt;
+    float hmin = dt / ROSS_DOPRI_MAXSTEPS;
+    float yzscale = x->yzscale;
+
+    t_ross_dopri d = x->dopri;
+
+    if (d.restart) {
+        for (int j = 0; j < 3; j++)
+            d.y[j] = x->state[j];
+        d.span = 0.f;
+        d.tau = 0.f;
+        d.h = dt;
+        d.restart = false;
+        rossler_slope(d.y[0], d.y[1], d.y[2], A, B, C, 0.f, d.k1);
+    }
+
+    float s[3] = { x->state[0], x->state[1], x->state[2] };
+
+    for (int i = 0; i < frames; i++) {
+        float ext = external ? extin[i] : 0.f;
+        float pert = external ? ext * gain : 0.f;
+
+        if (abcs) {
+            A = abcs[i];
+            B = abcs[frames + i];
+            C = abcs[2 * frames + i];
+        }
+
+        d.tau += dts ? dts[i] : dt;
+
+        if (d.tau > d.span)
+            ross_dopri_advance(&d, hmin, A, B, C, pert, driven);
+
+        float theta = d.tau / d.span;
+        float theta1 = 1.f - theta;
+
+        for (int j = 0; j < 3; j++) {
+            float v = d.cont[0][j] + theta * (d.cont[1][j] + theta1 * (d.cont[2][j] + theta * (d.cont[3][j] + theta1 * d.cont[4][j])));
+            s[j] = br_clamp(v, -20.f, 20.f);
+        }
+
+        out[i] = external ? s[0] / 3.0f * (1 - mix) + mix * ext : s[0] / 3.0f * (1 - mix);
+        if (yout) {
+            yout[i] = s[1] * yzscale;
+            zout[i] = s[2] * yzscale;
+        }
+    }
+
+    x->clamped += d.clamped;
+    x->nonfinite |= d.nonfinite;
+    d.clamped = 0;
+    d.nonfinite = false;
+    x->dopri = d;
+    for (int j = 0; j < 3; j++)
+        x->state[j] = s[j];
+}
+
+static bool ross_constant(const t_sample* in, int frames)
+{
+    for (int i = 1; i < frames; i++) {
+        if (in[i] != in[0])
+            return false;
+    }
+    return true;
+}
+
+// Returns the step of every sample when the pitch inlet is modulated, or
+// null when it holds still and the cached step applies. exp2 is a fast
+// approximation here, the cached step is exact.
+static const float* ross_modulate(t_ross* x, const t_sample* pitchin, int frames)
+{
+    if (ross_constant(pitchin, frames)) {
+        if (pitchin[0] != x->pitchin) {
+            x->pitchin = pitchin[0];
+            ross_update_dt(x);
+        }
+        return 0;
+    }
+
+    float scale = x->sampletime * FREQ_C4 * 6.2831853f;
+    float pitch = x->pitch;
+    float* dts = x->dts;
+
+    for (int i = 0; i < frames; i++) {
+        float octaves = pitch + pitchin[i];
+        octaves = br_clamp(octaves, -10.f, 10.f);
+        dts[i] = scale * br_exp2(octaves);
+    }
+    return dts;
+}
+
+// Sets the coefficients of the block and returns them per sample when an
+// inlet is modulated, or null when all three are constant.
+static const float* ross_coefficients(t_ross* x, t_sample** in, int frames)
+{
+    const float params[3] = { x->a_param, x->b_param, x->c_param };
+    const float max[3] = { 1, 1, 30 };
+    float* coefs[3] = { &x->A, &x->B, &x->C };
+    bool constant = true;
+
+    for (int j = 0; j < 3; j++) {
+        float v = params[j] + in[j][0];
+        *coefs[j] = br_clamp(v, 0.f, max[j]);
+        constant = constant && ross_constant(in[j], frames);
+    }
+
+    if (constant)
+        return 0;
+
+    for (int j = 0; j < 3; j++) {
+        float* abcs = x->abcs + j * frames;
+        for (int i = 0; i < frames; i++) {
+            float v = params[j] + in[j][i];
+            abcs[i] = br_clamp(v, 0.f, max[j]);
+        }
+    }
+    return x->abcs;
+}
+
+// integrates a block with the current integrator
+static void ross_integrate(t_ross* x, int frames, const t_sample* extin, t_sample* out,
+    t_sample* yout, t_sample* zout, const float* dts, const float* abcs)
+{
+    switch (x->integrator) {
+    case ross_euler:
+        ross_run(x, frames, extin, out, yout, zout, dts, abcs, ross_euler);
+        break;
+    case ross_rk4:
+        ross_run(x, frames, extin, out, yout, zout, dts, abcs, ross_rk4);
+        break;
+    case ross_semi:
+        ross_run(x, frames, extin, out, yout, zout, dts, abcs, ross_semi);
+        break;
+    case ross_dopri:
+        ross_kernel_dopri(x, frames, extin, out, yout, zout, dts, abcs);
+        break;
+    default:
+        ross_run(x, frames, extin, out, yout, zout, dts, abcs, ross_heun);
+        break;
+    }
+}
+
+// --- orbit cache
+
+// For fixed coefficients and pitch the trajectory settles onto an orbit
+// that repeats more or less, so after the settling time a window of it is
+// recorded and then looped. The last samples of the window crossfade into
+// its start, the loop continues right after the crossfade. A change of the
+// parameters, a modulated inlet or an input that drives the state go back
+// to integrating, from the looped state.
+
+static void ross_cache_invalidate(t_ross* x)
+{
+    // the adaptive integrator has to pick up the looped state
+    if (x->cache.phase == ross_cache_playing)
+        ross_dopri_restart(x);
+
+    x->cache.phase = ross_cache_settling;
+    x->cache.settled = 0;
+}
+
+// the window follows the cache time and the sample rate
+static void ross_cache_resize(t_ross* x)
+{
+    t_ross_cache* c = &x->cache;
+    int length = (int)(x->cachetime / x->sampletime);
+
+    if (length != c->length) {
+        if (c->table)
+            freebytes(c->table, 3 * c->length * sizeof(float));
+        c->table = length > 0 ? (float*)getbytes(3 * length * sizeof(float)) : 0;
+        c->length = length;
+        c->fade = length / 4;
+        ross_cache_invalidate(x);
+    }
+}
+
+// cache seconds [settle]
+//
+// loops a window of this length once the parameters held still for the
+// settling time, half a second by default. 0 turns the cache off.
+static void ross_cache(t_ross* x, t_symbol* s, int argc, t_atom* argv)
+{
+    (void)s;
+
+    float time = atom_getfloatarg(0, argc, argv);
+    x->cachetime = br_clamp(time, 0.f, ROSS_CACHE_MAXTIME);
+    if (argc > 1) {
+        float settle = atom_getfloatarg(1, argc, argv);
+        x->cachesettle = br_clamp(settle, 0.f, ROSS_CACHE_MAXTIME);
+    }
+
+    ross_cache_resize(x);
+    ross_cache_invalidate(x);
+}
+
+// returns whether the window still belongs to the current parameters
+static bool ross_cache_valid(t_ross* x)
+{
+    const float key[5] = { x->A, x->B, x->C, x->dt, (float)x->integrator };
+    bool valid = true;
+
+    for (int j = 0; j < 5; j++) {
+        valid = valid && key[j] == x->cache.key[j];
+        x->cache.key[j] = key[j];
+    }
+    return valid;
+}
+
+// Records up to frames samples of the window with the integrator. The
+// state comes through the outputs into the recorded buffer: x scaled to the
+// output with the mix taken out, y and z unscaled. Their output is
+// overwritten by the loop.
+static void ross_cache_record(t_ross* x, int frames, const t_sample* extin)
+{
+    t_ross_cache* c = &x->cache;
+    int n = br_minimum(frames, c->length - c->pos);
+
+    t_sample* xs = x->recorded;
+    t_sample* ys = x->recorded + frames;
+    t_sample* zs = x->recorded + 2 * frames;
+
+    float mix = x->mix;
+    float yzscale = x->yzscale;
+    x->mix = 0;
+    x->yzscale = 1;
+    ross_integrate(x, n, extin, xs, ys, zs, 0, 0);
+    x->mix = mix;
+    x->yzscale = yzscale;
 
-    float A = x->a_param;
-    float B = x->b_param;
-    float C = x->c_param;
+    float* t = c->table + 3 * c->pos;
+    for (int i = 0; i < n; i++) {
+        t[3 * i] = (float)xs[i] * 3.0f;
+        t[3 * i + 1] = (float)ys[i];
+        t[3 * i + 2] = (float)zs[i];
+    }
+}
 
-    float pitch = FREQ_C4 * powf(2.f, x->pitch) * 6.2831853f;
-    float dt = x->sampletime * pitch / 2.0f;
+// Plays the window, the samples recorded in this block included. Its end
+// crossfades into its start, and the loop continues right after that.
+static void ross_cache_loop(t_ross* x, int frames, const t_sample* extin, t_sample* out,
+    t_sample* yout, t_sample* zout)
+{
+    t_ross_cache* c = &x->cache;
+    const float* table = c->table;
+    int length = c->length;
+    int fade = c->fade;
+    int start = length - fade;
+    int pos = c->pos;
+
+    float mix = x->mix;
+    float yzscale = x->yzscale;
+    float xfade = 1.f / br_maximum(fade, 1);
+    float s[3] = { x->state[0], x->state[1], x->state[2] };
 
     for (int i = 0; i < frames; i++) {
-        float ext = extin[i];
-        float k[3];
-        float k2[3];
+        const float* t = table + 3 * pos;
+        for (int j = 0; j < 3; j++)
+            s[j] = t[j];
+
+        if (pos >= start) {
+            float w = (pos - start) * xfade;
+            const float* u = table + 3 * (pos - start);
+            for (int j = 0; j < 3; j++)
+                s[j] += w * (u[j] - s[j]);
+        }
+
+        // the input only reaches the output here
+        out[i] = s[0] / 3.0f * (1 - mix) + mix * extin[i];
+        if (yout) {
+            yout[i] = s[1] * yzscale;
+            zout[i] = s[2] * yzscale;
+        }
+
+        if (++pos == length) {
+            pos = fade;
+            c->phase = ross_cache_playing;
+        }
+    }
+
+    c->pos = pos;
+    if (c->phase == ross_cache_playing) {
+        for (int j = 0; j < 3; j++)
+            x->state[j] = s[j];
+    }
+}
+
+static void ross_cache_perform(t_ross* x, int frames, const t_sample* extin, t_sample* out,
+    t_sample* yout, t_sample* zout, const float* dts, const float* abcs)
+{
+    t_ross_cache* c = &x->cache;
+
+    bool autonomous = !dts && !abcs && (x->gain == 0 || ross_silent(extin, frames));
+    if (!ross_cache_valid(x) || !autonomous)
+        ross_cache_invalidate(x);
+
+    if (c->phase == ross_cache_settling) {
+        ross_integrate(x, frames, extin, out, yout, zout, dts, abcs);
+
+        if (autonomous)
+            c->settled += frames;
+        if (c->settled >= (int)(x->cachesettle / x->sampletime)) {
+            c->phase = ross_cache_recording;
+            c->pos = 0;
+        }
+        return;
+    }
+
+    if (c->phase == ross_cache_recording)
+        ross_cache_record(x, frames, extin);
+    ross_cache_loop(x, frames, extin, out, yout, zout);
+}
+
+// restore x y z continues from a state taken with the state message
+static void ross_restore(t_ross* x, t_symbol* s, int argc, t_atom* argv)
+{
+    (void)s;
 
-        rossler_slope(x->xout, x->yout, x->zout, A, B, C, ext * gain, k);
-        rossler_slope(x->xout + k[0] * dt, x->yout + k[1] * dt, x->zout + k[2] * dt, A, B, C, ext * gain, k2);
+    if (argc != 3) {
+        pd_error(x, "ross~: restore expects x, y and z");
+        return;
+    }
+
+    for (int j = 0; j < 3; j++) {
+        float v = atom_getfloat(argv + j);
+        x->state[j] = br_clamp(v, -20.f, 20.f);
+    }
+
+    ross_dopri_restart(x);
+    ross_cache_invalidate(x);
+}
 
-        x->xout += (k[0] + k2[0]) * dt;
-        x->yout += (k[1] + k2[1]) * dt;
-        x->zout += (k[2] + k2[2]) * dt;
+// A block diverged when the state went to NaN or infinity. The clamp
+// catches a trajectory that merely runs away, hitting it is no sign of
+// divergence on its own.
+static void ross_check(t_ross* x)
+{
+    bool nonfinite = x->nonfinite;
+    x->clamps += x->clamped;
+    x->clamped = 0;
+    x->nonfinite = false;
 
-        x->xout = br_clamp(x->xout, -20.f, 20.f);
-        x->yout = br_clamp(x->yout, -20.f, 20.f);
-        x->zout = br_clamp(x->zout, -20.f, 20.f);
+    if (!nonfinite)
+        return;
 
-        out[i] = x->xout / 3.0f * (1 - mix) + mix * ext;
+    x->diverged++;
+    if (x->autoreset) {
+        ross_initial_state(x);
+        ross_cache_invalidate(x);
+        x->resets++;
     }
+}
 
-    return (w + 5);
+static t_int* ross_perform(t_int* w)
+{
+    t_ross* x = (t_ross*)(w[1]);
+    int frames = (int)w[2];
+    t_sample* extin = (t_sample*)w[3];
+    t_sample* pitchin = (t_sample*)w[4];
+    t_sample* abcin[3] = { (t_sample*)w[5], (t_sample*)w[6], (t_sample*)w[7] };
+    t_sample* out = (t_sample*)w[8];
+    t_sample* yout = (t_sample*)w[9];
+    t_sample* zout = (t_sample*)w[10];
+
+    if (x->ramping)
+        ross_ramp_block(x);
+
+    const float* dts = ross_modulate(x, pitchin, frames);
+    const float* abcs = ross_coefficients(x, abcin, frames);
+
+    if (x->cache.length > 0)
+        ross_cache_perform(x, frames, extin, out, yout, zout, dts, abcs);
+    else
+        ross_integrate(x, frames, extin, out, yout, zout, dts, abcs);
+
+    ross_check(x);
+
+    return (w + 11);
 }
 
 static void ross_dsp(t_ross* x, t_signal** sp)
 {
-    dsp_add(ross_perform, 4, x, sp[0]->s_n, sp[0]->s_vec, sp[1]->s_vec);
+    // the signal's rate, which differs from sys_getsr() when resampled by block~
+    x->sampletime = 1.f / sp[0]->s_sr;
+    ross_update_dt(x);
+    ross_cache_resize(x);
+
+    int n = sp[0]->s_n;
+    if (n != x->nbuffers) {
+        x->buffers = (float*)resizebytes(x->buffers, 4 * x->nbuffers * sizeof(float), 4 * n * sizeof(float));
+        x->recorded = (t_sample*)resizebytes(x->recorded, 3 * x->nbuffers * sizeof(t_sample),
+            3 * n * sizeof(t_sample));
+        x->nbuffers = n;
+        x->dts = x->buffers;
+        x->abcs = x->buffers + n;
+    }
+
+    // without the y and z outlets their vectors are null
+    t_sample* yout = x->y_outlet ? sp[6]->s_vec : 0;
+    t_sample* zout = x->z_outlet ? sp[7]->s_vec : 0;
+
+    dsp_add(ross_perform, 10, x, n, sp[0]->s_vec, sp[1]->s_vec, sp[2]->s_vec, sp[3]->s_vec,
+        sp[4]->s_vec, sp[5]->s_vec, yout, zout);
 }
 
 // --- init
 
 static void ross_reset(t_ross* x)
 {
-    x->xout = 0.f;
-    x->yout = 5.f;
-    x->zout = 0.f;
+    ross_initial_state(x);
 
     x->pitch = 0;
     x->gain = 0;
@@ -131,29 +1117,101 @@ static void ross_reset(t_ross* x)
     x->b_param = 0.2;
     x->c_param = 5.7;
 
-    x->sampletime = 1.f / sys_getsr();
+    x->integrator = ross_heun;
+
+    for (int j = 0; j < ross_ramps; j++)
+        x->ramps[j].blocks = 0;
+    x->ramping = false;
+
+    ross_cache_invalidate(x);
+    ross_update_dt(x);
 }
 
-static void* ross_new(void)
+// ross~ [-yz] [-norm] [-double] [x y z]
+//
+// -yz adds outlets for y and z, scaled like x. -norm implies -yz and scales
+// them by the clamp range instead, which keeps them within -1 to 1. The
+// rightmost outlet outputs the state on the state message. -double
+// integrates in double precision, for slow modulation at a low pitch. x, y
+// and z are the initial state, 0 5 0 by default, which reset returns to.
+static void* ross_new(t_symbol* s, int argc, t_atom* argv)
 {
+    (void)s;
+
     t_ross* x = (t_ross*)pd_new(ross_class);
+    x->sampletime = 1.f / sys_getsr();
+
+    float* params[ross_ramps] = { &x->a_param, &x->b_param, &x->c_param, &x->pitch, &x->mix, &x->gain };
+    for (int j = 0; j < ross_ramps; j++)
+        x->ramps[j].value = params[j];
+
+    x->cachesettle = 0.5f;
+
+    bool yz = false;
+    x->yzscale = 1.f / 3.f;
+
+    const float initial[3] = { 0.f, 5.f, 0.f };
+    int values = 0;
+    for (int j = 0; j < 3; j++)
+        x->initial[j] = initial[j];
+
+    for (int i = 0; i < argc; i++) {
+        if (argv[i].a_type == A_FLOAT) {
+            float v = atom_getfloat(argv + i);
+            if (values < 3)
+                x->initial[values++] = br_clamp(v, -20.f, 20.f);
+            else
+                pd_error(x, "ross~: extra initial value %g, expects x y z", v);
+            continue;
+        }
+
+        t_symbol* flag = atom_getsymbol(argv + i);
+        if (flag == gensym("-yz"))
+            yz = true;
+        else if (flag == gensym("-norm")) {
+            yz = true;
+            x->yzscale = 1.f / 20.f;
+        } else if (flag == gensym("-double"))
+            x->precise = true;
+        else
+            pd_error(x, "ross~: unknown argument %s (-yz, -norm, -double)", flag->s_name);
+    }
+
     ross_reset(x);
 
+    // pitch in octaves, a, b and c, each added to its message
+    for (int i = 0; i < 4; i++)
+        inlet_new(&x->x_obj, &x->x_obj.ob_pd, &s_signal, &s_signal);
+
     x->x_outlet = outlet_new(&x->x_obj, &s_signal);
+    if (yz) {
+        x->y_outlet = outlet_new(&x->x_obj, &s_signal);
+        x->z_outlet = outlet_new(&x->x_obj, &s_signal);
+    }
+    x->state_outlet = outlet_new(&x->x_obj, &s_list);
 
     return (void*)x;
 }
 
 static void* ross_free(t_ross* x)
 {
+    freebytes(x->buffers, 4 * x->nbuffers * sizeof(float));
+    freebytes(x->recorded, 3 * x->nbuffers * sizeof(t_sample));
+    if (x->cache.table)
+        freebytes(x->cache.table, 3 * x->cache.length * sizeof(float));
     outlet_free(x->x_outlet);
+    if (x->y_outlet) {
+        outlet_free(x->y_outlet);
+        outlet_free(x->z_outlet);
+    }
+    outlet_free(x->state_outlet);
     return (void*)x;
 }
 
 void ross_tilde_setup(void)
 {
-    ross_class = class_new(gensym("ross~"), (t_newmethod)ross_new, (t_method)ross_free,
-        sizeof(t_ross), CLASS_DEFAULT, 0);
+    ross_class = class_new(gensym("ross~"), (t_newmethod)(t_method)ross_new, (t_method)ross_free,
+        sizeof(t_ross), CLASS_DEFAULT, A_GIMME, 0);
 
     class_addmethod(ross_class, nullfn, gensym("signal"), 0);
     class_addmethod(ross_class, (t_method)ross_dsp, gensym("dsp"), A_CANT, 0);
@@ -165,4 +1223,11 @@ void ross_tilde_setup(void)
     class_addmethod(ross_class, (t_method)ross_pitch, gensym("pitch"), A_FLOAT, 0);
     class_addmethod(ross_class, (t_method)ross_mix, gensym("mix"), A_FLOAT, 0);
     class_addmethod(ross_class, (t_method)ross_gain, gensym("gain"), A_FLOAT, 0);
+    class_addmethod(ross_class, (t_method)ross_integrator_set, gensym("integrator"), A_SYMBOL, 0);
+    class_addmethod(ross_class, (t_method)ross_ramp, gensym("ramp"), A_FLOAT, 0);
+    class_addmethod(ross_class, (t_method)ross_cache, gensym("cache"), A_GIMME, 0);
+    class_addmethod(ross_class, (t_method)ross_stats, gensym("stats"), 0);
+    class_addmethod(ross_class, (t_method)ross_state, gensym("state"), 0);
+    class_addmethod(ross_class, (t_method)ross_restore, gensym("restore"), A_GIMME, 0);
+    class_addmethod(ross_class, (t_method)ross_autoreset, gensym("autoreset"), A_FLOAT, 0);
 }
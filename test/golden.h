@@ -0,0 +1,1280 @@
+// generated by make golden, do not edit
+
+static const char* golden_names[] = {
+    "ross~ default",
+    "ross~ pitch 2",
+    "ross~ a b c",
+    "ross~ driven",
+    "ross~ dry",
+    "ross~ euler",
+    "ross~ rk4",
+    "ross~ semi",
+    "ross~ dopri",
+    "ross~ dopri driven",
+    "lorenz~ default",
+    "chua~ driven",
+    "thomas~ rk4",
+    "aizawa~ euler",
+    "gendy~ default",
+    "gendy~ cauchy",
+    "gendy~ logist hyperbcos",
+    "gendy~ arcsine expon",
+    "gendy~ single point",
+};
+
+static const float golden_data[][512] = {
+    // ross~ default
+    {
+        -0.031132251, -0.0625167266, -0.0941026211, -0.125839889, -0.1576792, -0.189571828, -0.221469551, -0.253324628,
+        -0.285089731, -0.316717863, -0.348162353, -0.379376739, -0.410314918, -0.440931022, -0.471179366, -0.501014769,
+        -0.53039211, -0.559266806, -0.587594628, -0.615331769, -0.642434835, -0.668861091, -0.694568396, -0.719515264,
+        -0.743660867, -0.76696527, -0.789389253, -0.810894489, -0.831443787, -0.851000786, -0.86953038, -0.886998355,
+        -0.90337199, -0.918619573, -0.932710826, -0.945616722, -0.957309842, -0.96776402, -0.976954639, -0.984858692,
+        -0.99145484, -0.996723294, -1.00064588, -1.00320625, -1.00438976, -1.00418365, -1.00257695, -0.999560535,
+        -0.995127141, -0.989271522, -0.981990099, -0.973281622, -0.963146627, -0.951587617, -0.938609123, -0.924217701,
+        -0.908421934, -0.891232431, -0.872661769, -0.852724671, -0.831437767, -0.80881989, -0.784891605, -0.759675741,
+        -0.733196914, -0.705481768, -0.676558971, -0.646458983, -0.615214229, -0.582859039, -0.549429417, -0.514963388,
+        -0.479500592, -0.443082392, -0.405751884, -0.367553771, -0.328534335, -0.28874141, -0.248224318, -0.207033798,
+        -0.165221959, -0.122842215, -0.0799492598, -0.036598932, 0.00715176295, 0.0512447953, 0.0956211314, 0.140220851,
+        0.184983134, 0.229846448, 0.274748504, 0.319626421, 0.364416778, 0.40905565, 0.453478694, 0.497621298,
+        0.541418612, 0.584805489, 0.62771678, 0.670087337, 0.711851954, 0.752945423, 0.793303013, 0.832859993,
+        0.871551991, 0.909314871, 0.946084976, 0.981799006, 1.01639414, 1.04980791, 1.08197856, 1.11284447,
+        1.14234483, 1.1704191, 1.19700718, 1.22204924, 1.24548602, 1.26725829, 1.28730702, 1.30557311,
+        1.32199776, 1.33652186, 1.34908581, 1.35963035, 1.36809528, 1.37442052, 1.37854564, 1.38041008,
+        1.37995374, 1.37711716, 1.37184238, 1.36407351, 1.35375786, 1.34084797, 1.32530248, 1.30708861,
+        1.28618407, 1.26258004, 1.23628354, 1.20731997, 1.17573547, 1.14159966, 1.10500646, 1.06607521,
+        1.02495015, 0.981799126, 0.93681097, 0.890191197, 0.842156887, 0.79293108, 0.742735803, 0.691785693,
+        0.640281796, 0.588406324, 0.536317945, 0.484149754, 0.432007521, 0.379970282, 0.328092039, 0.276404679,
+        0.224921584, 0.173641831, 0.122554481, 0.0716428533, 0.0208882056, -0.0297268927, -0.0802159458, -0.13058652,
+        -0.180838913, -0.230965376, -0.280949891, -0.330768257, -0.380388677, -0.429772347, -0.478874296, -0.527644277,
+        -0.576027572, -0.623965979, -0.67139852, -0.718261838, -0.76449132, -0.810021281, -0.854785204, -0.898716629,
+        -0.941749036, -0.983816266, -1.02485263, -1.06479311, -1.10357368, -1.14113116, -1.17740345, -1.2123301,
+        -1.2458514, -1.27790952, -1.30844796, -1.33741212, -1.36474872, -1.39040661, -1.41433656, -1.43649125,
+        -1.45682526, -1.47529578, -1.4918617, -1.50648475, -1.51912856, -1.52975965, -1.53834665, -1.5448612,
+        -1.54927719, -1.55157161, -1.55172384, -1.54971635, -1.54553437, -1.53916597, -1.53060234, -1.51983738,
+        -1.50686836, -1.4916954, -1.4743216, -1.45475328, -1.43299985, -1.40907371, -1.38299072, -1.35476947,
+        -1.3244319, -1.29200315, -1.25751138, -1.2209878, -1.18246675, -1.14198577, -1.09958518, -1.05530858,
+        -1.00920224, -0.961315751, -0.911701322, -0.860414028, -0.807511806, -0.753055334, -0.697107971, -0.639735579,
+        -0.581006646, -0.5209921, -0.459765315, -0.397401989, -0.333979964, -0.269579351, -0.204282165, -0.138172567,
+        -0.0713364556, -0.00386159122, 0.064162612, 0.132645145, 0.201493531, 0.270613879, 0.339911044, 0.409288585,
+        0.47864908, 0.547894061, 0.616924107, 0.685638905, 0.753937483, 0.821717978, 0.888877869, 0.955313921,
+        1.02092218, 1.08559799, 1.14923549, 1.2117281, 1.2729677, 1.3328445, 1.39124632, 1.44805837,
+        1.50316167, 1.55643225, 1.60773969, 1.65694451, 1.70389557, 1.74842715, 1.79035306, 1.82946146,
+        1.86550701, 1.89820099, 1.92719877, 1.95208406, 1.97234988, 1.98737526, 1.99639893, 1.9984889,
+        1.99251258, 1.9771111, 1.95068574, 1.91141057, 1.85728955, 1.7862823, 1.69652498, 1.58666182,
+        1.45917785, 1.33046675, 1.20069993, 1.07005024, 0.938692272, 0.806801438, 0.675725937, 0.549136996,
+        0.43020305, 0.321283937, 0.223784089, 0.13817507, 0.0641484857, 0.000837405561, -0.0529545099, -0.0985569879,
+        -0.137289047, -0.170367628, -0.198860034, -0.223667979, -0.245531723, -0.265045166, -0.282675922, -0.298786312,
+        -0.313652813, -0.327483445, -0.340432495, -0.352612346, -0.364103317, -0.374961317, -0.385223746, -0.394914359,
+        -0.404046595, -0.412626475, -0.420654655, -0.428128004, -0.435040683, -0.44138515, -0.447152823, -0.452334404,
+        -0.456920505, -0.460901707, -0.464268893, -0.467013329, -0.469126821, -0.470601797, -0.471431434, -0.471609563,
+        -0.471130908, -0.469990939, -0.468185991, -0.465713263, -0.462570876, -0.458757818, -0.454273999, -0.449120253,
+        -0.443298399, -0.436811149, -0.429662168, -0.421856046, -0.413398445, -0.404295802, -0.394555658, -0.384186387,
+        -0.373197407, -0.361598969, -0.349402398, -0.336619794, -0.323264271, -0.309349835, -0.294891357, -0.279904604,
+        -0.264406204, -0.248413667, -0.231945306, -0.215020239, -0.197658405, -0.179880485, -0.161707953, -0.143162966,
+        -0.124268427, -0.105047874, -0.085525535, -0.0657262281, -0.0456753746, -0.0253989603, -0.00492350291, 0.0157239884,
+        0.0365160406, 0.0574247353, 0.0784217864, 0.099478513, 0.120565951, 0.141654834, 0.162715629, 0.183718622,
+        0.204633936, 0.225431547, 0.246081337, 0.266553164, 0.286816895, 0.306842417, 0.326599687, 0.346058786,
+        0.365189999, 0.383963794, 0.402350873, 0.420322269, 0.437849373, 0.454903901, 0.471458018, 0.487484396,
+        0.502956212, 0.51784718, 0.532131672, 0.545784652, 0.558781743, 0.571099341, 0.582714677, 0.593605638,
+        0.603751183, 0.613131046, 0.621725798, 0.629517138, 0.636487722, 0.642621279, 0.647902608, 0.652317524,
+        0.655853212, 0.65849781, 0.660240889, 0.661073029, 0.660986245, 0.6599738, 0.658030272, 0.655151486,
+        0.651334763, 0.64657867, 0.640883207, 0.634249568, 0.626680613, 0.618180394, 0.608754396, 0.598409414,
+        0.587153614, 0.574996591, 0.561949134, 0.548023522, 0.533233106, 0.517592669, 0.501118124, 0.483826697,
+        0.465736717, 0.446867764, 0.427240431, 0.406876534, 0.385798931, 0.364031523, 0.341599196, 0.318527907,
+        0.294844568, 0.270577013, 0.245754033, 0.220405325, 0.194561467, 0.168253884, 0.141514853, 0.114377432,
+        0.0868754834, 0.0590436086, 0.0309171304, 0.00253207237, -0.0260749012, -0.0548665002, -0.0838048607, -0.112851582,
+        -0.141967773, -0.171114117, -0.200250849, -0.229337931, -0.258334994, -0.287201405, -0.315896392, -0.344379038,
+        -0.372608393, -0.400543422, -0.428143203, -0.45536691, -0.4821738, -0.508523524, -0.534375906, -0.559691072,
+        -0.584429622, -0.608552694, -0.632021904, -0.654799283, -0.676847696, -0.698130786, -0.718612671, -0.738258541,
+        -0.757034242, -0.774906814, -0.79184401, -0.807814777, -0.822789133, -0.83673811, -0.849634111, -0.861450613,
+        -0.872162521, -0.881745994, -0.890178561, -0.897439122, -0.903508127, -0.908367515, -0.912000597, -0.914392471 },
+    // ross~ pitch 2
+    {
+        -0.125362664, -0.253528953, -0.381365836, -0.505875826, -0.624111354, -0.733170033, -0.830238581, -0.9126544,
+        -0.977971554, -1.0240252, -1.04899156, -1.05144429, -1.03040242, -0.985370994, -0.916372955, -0.823970079,
+        -0.709272861, -0.573938787, -0.420158446, -0.250629157, -0.0685167164, 0.122594342, 0.318760753, 0.515748978,
+        0.709109664, 0.894253194, 1.06652045, 1.22123528, 1.35372055, 1.45924067, 1.53281879, 1.56886363,
+        1.56058252, 1.49941444, 1.37542391, 1.18085921, 0.919251382, 0.616346061, 0.316198736, 0.0524582267,
+        -0.173431203, -0.377929628, -0.57297045, -0.760965347, -0.939259768, -1.10376382, -1.25026011, -1.37473094,
+        -1.47348309, -1.54324508, -1.58125925, -1.5853653, -1.55407369, -1.48662686, -1.38304698, -1.24416828,
+        -1.0716517, -0.867983222, -0.636452317, -0.38111338, -0.106728733, 0.181304634, 0.477041721, 0.77408427,
+        1.0656718, 1.34474444, 1.6039145, 1.83518732, 2.02899265, 2.17131615, 2.23569727, 2.16269112,
+        1.81938291, 1.21572363, 0.644257069, 0.113909885, -0.221715137, -0.379486412, -0.469424307, -0.538821101,
+        -0.596825004, -0.643529534, -0.677668452, -0.697988689, -0.703470826, -0.693383396, -0.667313695, -0.625190258,
+        -0.567299008, -0.494291425, -0.407185912, -0.307359874, -0.196534202, -0.0767495483, 0.0496657602, 0.180134982,
+        0.311879247, 0.441969752, 0.567384839, 0.685070395, 0.792002857, 0.885252953, 0.962049425, 1.01984274,
+        1.05637217, 1.06973994, 1.05850363, 1.0217936, 0.959457815, 0.872205973, 0.761686504, 0.630402446,
+        0.481419653, 0.317955732, 0.143079907, -0.0402838215, -0.229095727, -0.419938028, -0.608955145, -0.791981399,
+        -0.964721441, -1.12290144, -1.2623868, -1.37928724, -1.4700551, -1.53158092, -1.56128109, -1.55717838,
+        -1.51797152, -1.44309282, -1.33275127, -1.18796062, -1.01054978, -0.803157032, -0.569204509, -0.31285587,
+        -0.0389562063, 0.24704355, 0.539174795, 0.831045389, 1.11592758, 1.38680959, 1.63634205, 1.85649347,
+        2.03742027, 2.16420603, 2.20799875, 2.10426927, 1.71486568, 1.11250257, 0.544272304, 0.0188970175,
+        -0.286178768, -0.427312911, -0.513457537, -0.582187116, -0.639343262, -0.684335709, -0.71579349, -0.732470036,
+        -0.733386397, -0.717875242, -0.685610056, -0.636626422, -0.571336687, -0.490536422, -0.39540273, -0.287483811,
+        -0.16868028, -0.0412174687, 0.0923900828, 0.229381904, 0.366801739, 0.501553416, 0.630460978, 0.750332475,
+        0.85802412, 0.950505376, 1.02492177, 1.07865858, 1.10940754, 1.11524653, 1.09474742, 1.04712868,
+        0.972452044, 0.871822238, 0.747475564, 0.602613926, 0.440931559, 0.26602456, 0.0810546279, -0.111102462,
+        -0.307408631, -0.50432837, -0.697819173, -0.883532465, -1.05702829, -1.21393144, -1.35005045, -1.46148276,
+        -1.54471588, -1.59672344, -1.6150527, -1.59790504, -1.54420221, -1.45364165, -1.32673514, -1.16483164,
+        -0.970122039, -0.745625436, -0.495157182, -0.223278105, 0.0647734255, 0.363164514, 0.665561378, 0.965224624,
+        1.25508714, 1.52776706, 1.7753973, 1.98894191, 2.15608191, 2.2551136, 2.23837471, 1.9941982,
+        1.38914824, 0.812974393, 0.274936527, -0.118995152, -0.314156234, -0.413421035, -0.483404517, -0.541089118,
+        -0.588351965, -0.624258876, -0.647610247, -0.657375991, -0.652781069, -0.633339524, -0.598878086, -0.549553454,
+        -0.485862345, -0.408644646, -0.319079131, -0.218671247, -0.10923329, 0.00714304065, 0.128121316, 0.251161754,
+        0.373568416, 0.492541879, 0.605235219, 0.708813548, 0.800515115, 0.877713323, 0.93797946, 0.97914803,
+        0.999385059, 0.997266471, 0.971866846, 0.922859371, 0.850609004, 0.756224811, 0.641521871, 0.508864164,
+        0.36092636, 0.200487301, 0.0303718857, -0.146445751, -0.326696038, -0.506758928, -0.682732761, -0.850566149,
+        -1.00618863, -1.14562273, -1.26508379, -1.36107588, -1.4304831, -1.4706552, -1.47948766, -1.45549107,
+        -1.39785075, -1.30647278, -1.18201685, -1.02591205, -0.840358019, -0.628308058, -0.393434942, -0.140080601,
+        0.126810074, 0.401769012, 0.678893924, 0.951938987, 1.21439052, 1.4594903, 1.6801188, 1.86830974,
+        2.01382041, 2.10030079, 2.09580231, 1.93290281, 1.48724985, 0.88459605, 0.320587218, -0.119985461,
+        -0.350604147, -0.4734101, -0.564027309, -0.641368032, -0.706939101, -0.759274185, -0.796707273, -0.817792296,
+        -0.82138598, -0.806689441, -0.773280799, -0.721140385, -0.650668263, -0.562692523, -0.458468765, -0.3396703,
+        -0.208368108, -0.0670016855, 0.081659399, 0.234562397, 0.388425916, 0.539800644, 0.68513453, 0.820840538,
+        0.943363786, 1.04924536, 1.13517976, 1.19806433, 1.23504472, 1.24357319, 1.22151554, 1.16737223,
+        1.08068013, 0.962585211, 0.81635499, 0.647334576, 0.461907953, 0.265771747, 0.0627379417, -0.144942373,
+        -0.355199665, -0.565067768, -0.770567179, -0.967142284, -1.15007627, -1.31472397, -1.4566493, -1.57173944,
+        -1.65631044, -1.70720959, -1.72190809, -1.69858396, -1.63619232, -1.53452158, -1.39423251, -1.2168802,
+        -1.00491691, -0.761674523, -0.491327941, -0.198838592, 0.110120162, 0.429252714, 0.751740456, 1.07033849,
+        1.37744021, 1.66503882, 1.9243803, 2.14472198, 2.30942178, 2.38413668, 2.28362799, 1.80060518,
+        1.21699655, 0.664101422, 0.150587767, -0.17602323, -0.323623866, -0.398940891, -0.452124208, -0.494432926,
+        -0.526922703, -0.548845649, -0.559330821, -0.557681382, -0.543437839, -0.516403556, -0.47666055, -0.424579352,
+        -0.360823005, -0.28634429, -0.202376604, -0.110418133, -0.0122095644, 0.0902945027, 0.194960088, 0.299513638,
+        0.401586533, 0.498763502, 0.588634014, 0.66884625, 0.737161994, 0.791513205, 0.830059469, 0.851245821,
+        0.853861928, 0.837100685, 0.80061233, 0.744545579, 0.669563532, 0.576822162, 0.467909038, 0.344758928,
+        0.209579095, 0.0648138523, -0.0868498906, -0.242466092, -0.39884001, -0.552579582, -0.700175762, -0.838092208,
+        -0.962853193, -1.07112944, -1.15982044, -1.2261349, -1.26766658, -1.28246474, -1.26909709, -1.22670329,
+        -1.15503883, -1.05450547, -0.926169872, -0.771767557, -0.593691826, -0.394968569, -0.179215938, 0.0494100265,
+        0.28628242, 0.526380897, 0.764374912, 0.994706154, 1.21165478, 1.40935946, 1.58172691, 1.72208691,
+        1.82228601, 1.87060499, 1.84755802, 1.7193563, 1.43527198, 0.956393123, 0.353783309, -0.145312756,
+        -0.420948088, -0.577474117, -0.70026511, -0.808725059, -0.903152108, -0.981166065, -1.04036558, -1.07865214,
+        -1.09430814, -1.0860517, -1.05308414, -0.995127559, -0.912453651, -0.805900216, -0.67687577, -0.52735275,
+        -0.359846801, -0.177384064, 0.0165440254, 0.218037188, 0.422852635, 0.626478851, 0.82421273, 1.01123464,
+        1.18266892, 1.3336122, 1.45909142, 1.55389142, 1.61215138, 1.62662125, 1.58760679, 1.48228741,
+        1.29683733, 1.02603054, 0.691466331, 0.349236816, 0.0556204729, -0.179018721, -0.378853321, -0.5643152,
+        -0.741489112, -0.908800304, -1.06253719, -1.19874585, -1.31365967, -1.40382946, -1.46621644, -1.4982785,
+        -1.49804735, -1.46419764, -1.39610291, -1.29387903, -1.15841246, -0.991373241, -0.795209765, -0.57312727 },
+    // ross~ a b c
+    {
+        -0.0625655502, -0.126582712, -0.191563398, -0.257117182, -0.322877467, -0.388478369, -0.453548849, -0.517712295,
+        -0.580587864, -0.641792178, -0.700941682, -0.757654428, -0.811552465, -0.862264037, -0.909425616, -0.952684402,
+        -0.99170059, -1.02614927, -1.05572271, -1.08013308, -1.0991137, -1.11242163, -1.11983955, -1.12117743,
+        -1.1162746, -1.10500109, -1.08725917, -1.06298494, -1.03214943, -0.9947595, -0.95085901, -0.900529146,
+        -0.843889356, -0.781097293, -0.712348938, -0.637878835, -0.557959259, -0.472900033, -0.38304767, -0.288784266,
+        -0.190526411, -0.0887236297, 0.0161431134, 0.123563439, 0.232999533, 0.343888402, 0.455644548, 0.567662239,
+        0.679318666, 0.789976835, 0.898988605, 1.00569785, 1.10944414, 1.20956612, 1.30540454, 1.39630675,
+        1.48162961, 1.56074369, 1.63303697, 1.69791877, 1.75482368, 1.80321622, 1.8425945, 1.87249589,
+        1.89250135, 1.90224206, 1.90140426, 1.88973618, 1.86705399, 1.83324695, 1.78828084, 1.7322005,
+        1.66512632, 1.58724999, 1.4988246, 1.40015495, 1.29158616, 1.17349672, 1.04629552, 0.910425067,
+        0.76636827, 0.614658356, 0.455887169, 0.290709972, 0.119846627, -0.0559212379, -0.235755503, -0.418767452,
+        -0.604023933, -0.790552855, -0.977348983, -1.16337895, -1.34758651, -1.52889895, -1.70623147, -1.87849402,
+        -2.04459715, -2.20345783, -2.35400581, -2.49519062, -2.62598705, -2.74540186, -2.85247993, -2.94631195,
+        -3.02603865, -3.09085798, -3.14003086, -3.17288756, -3.18883181, -3.18734717, -3.16800165, -3.13045168,
+        -3.07444715, -2.99983501, -2.90656233, -2.79467869, -2.66433978, -2.51580787, -2.34945393, -2.16575789,
+        -1.96530938, -1.74880624, -1.51705432, -1.27096534, -1.01955342, -0.768509567, -0.517836213, -0.267536432,
+        -0.017614346, 0.231924802, 0.481074095, 0.729824066, 0.97816205, 1.22607017, 1.47329938, 1.71841502,
+        1.9599402, 2.19635201, 2.42606974, 2.64742661, 2.85861111, 3.05754852, 3.24165869, 3.33333349,
+        3.33333349, 3.33333349, 3.33333349, 3.33333349, 3.243963, 3.04677629, 2.83936787, 2.62280774,
+        2.39820743, 2.16671562, 1.92951202, 1.68780136, 1.45631909, 1.25679898, 1.09856236, 0.978436172,
+        0.886509597, 0.812017322, 0.746371984, 0.683762014, 0.620657444, 0.555103004, 0.486134827, 0.413380831,
+        0.336811244, 0.256591618, 0.173000544, 0.086384967, -0.00286303973, -0.0943183899, -0.187529534, -0.282022297,
+        -0.377302825, -0.472860157, -0.5681687, -0.662690818, -0.755879641, -0.847181797, -0.936040342, -1.02189779,
+        -1.10419917, -1.1823957, -1.25594699, -1.32432532, -1.38701844, -1.44353247, -1.49339616, -1.53616309,
+        -1.57141519, -1.59876585, -1.61786306, -1.62839174, -1.63007677, -1.62268543, -1.60603023, -1.57997024,
+        -1.54441381, -1.49932003, -1.44470048, -1.38061988, -1.30719805, -1.22460961, -1.13308549, -1.03291178,
+        -0.924430847, -0.808040023, -0.684190929, -0.553388715, -0.416190326, -0.273202717, -0.125080943, 0.0274742655,
+        0.183719248, 0.342870235, 0.5041067, 0.666574597, 0.829390168, 0.991643608, 1.15240324, 1.31071889,
+        1.46562624, 1.61615026, 1.76130819, 1.90011203, 2.03156972, 2.15468454, 2.26845169, 2.37185097,
+        2.46383452, 2.54330444, 2.60908246, 2.65986419, 2.69416022, 2.71022463, 2.70598602, 2.67901206,
+        2.62656736, 2.54586887, 2.43465686, 2.29214954, 2.12025547, 1.92453384, 1.71407735, 1.49969053,
+        1.29080701, 1.09277153, 0.906088114, 0.727758408, 0.553480744, 0.379410207, 0.2029787, 0.0229495764,
+        -0.160899758, -0.348157644, -0.538070083, -0.729715109, -0.922089279, -1.11414433, -1.30480325, -1.49296796,
+        -1.677526, -1.85735655, -2.03133678, -2.19834709, -2.3572793, -2.50704169, -2.64656591, -2.77481413,
+        -2.89078474, -2.99351954, -3.08211017, -3.15570402, -3.21351099, -3.2548089, -3.27894974, -3.2853651,
+        -3.27357101, -3.2431736, -3.19387221, -3.12546492, -3.03785133, -2.931036, -2.80513072, -2.66035724,
+        -2.49704838, -2.31564903, -2.11671686, -1.90092123, -1.66904378, -1.42197549, -1.17034364, -0.919078708,
+        -0.668182731, -0.417658389, -0.167509168, 0.0822604746, 0.331644595, 0.580635488, 0.829222441, 1.07739103,
+        1.32512069, 1.57160068, 1.81537986, 2.0549643, 2.28881073, 2.51530886, 2.73274422, 2.93922043,
+        3.13250136, 3.30968904, 3.33333349, 3.33333349, 3.33333349, 3.33333349, 3.30484104, 3.16462994,
+        2.96321249, 2.75200462, 2.53209376, 2.30460691, 2.07070613, 1.83158135, 1.58844543, 1.3659637,
+        1.18169272, 1.03939962, 0.932114005, 0.848763585, 0.779113293, 0.715649307, 0.653550982, 0.590011597,
+        0.523546219, 0.45347771, 0.37960121, 0.301982045, 0.2208395, 0.136483014, 0.0492782593, -0.0403703451,
+        -0.132028818, -0.225238651, -0.319520235, -0.414375484, -0.509290278, -0.603737056, -0.69717741, -0.789064884,
+        -0.878847778, -0.965972066, -1.04988456, -1.13003576, -1.2058835, -1.27689588, -1.34255409, -1.40235662,
+        -1.45582175, -1.50249088, -1.54193187, -1.57374179, -1.59755063, -1.61302316, -1.61986279, -1.61781335,
+        -1.6066618, -1.58624101, -1.55643106, -1.51716161, -1.46841359, -1.41022015, -1.34266853, -1.26590014,
+        -1.18011189, -1.08555579, -0.982539535, -0.871426105, -0.752632976, -0.626631141, -0.493944108, -0.35514614,
+        -0.21086058, -0.0617574267, 0.0914489254, 0.248002619, 0.407109231, 0.567939162, 0.729631186, 0.89129591,
+        1.05201995, 1.21086943, 1.36689425, 1.51913166, 1.66660976, 1.80835032, 1.94337106, 2.07068634,
+        2.18930554, 2.29822993, 2.39644289, 2.48289633, 2.55648732, 2.61602569, 2.66018724, 2.68745613,
+        2.69606161, 2.68392372, 2.64865303, 2.58766532, 2.4985137, 2.3795352, 2.23081684, 2.055264,
+        1.85919607, 1.65174747, 1.44277227, 1.24001694, 1.04711723, 0.863513947, 0.685989797, 0.510626793,
+        0.334194839, 0.154702216, -0.0286643915, -0.215862989, -0.406334639, -0.599247813, -0.793637395, -0.988471389,
+        -1.18267894, -1.37516248, -1.56480539, -1.75047815, -1.93104446, -2.10536742, -2.27231598, -2.43077183,
+        -2.5796349, -2.71783161, -2.84432077, -2.95809937, -3.05821085, -3.14374995, -3.21387076, -3.26779175,
+        -3.30480242, -3.3242681, -3.32563686, -3.30844378, -3.2723155, -3.21697569, -3.14224815, -3.04806089,
+        -2.93444824, -2.8015554, -2.6496377, -2.47906375, -2.29031658, -2.08399224, -1.8608011, -1.6215657,
+        -1.36964452, -1.11808872, -0.866900146, -0.616081178, -0.365634501, -0.115563773, 0.134126276, 0.383429378,
+        0.632337272, 0.880838573, 1.12891781, 1.37655282, 1.62264097, 1.86572206, 2.10429263, 2.33679676,
+        2.56160617, 2.77697659, 2.98095703, 3.17120695, 3.33333349, 3.33333349, 3.33333349, 3.33333349,
+        3.33333349, 3.28499413, 3.11458087, 2.91134238, 2.69857883, 2.47738457, 2.24889183, 2.01426697,
+        1.77470303, 1.53593135, 1.32272816, 1.14942539, 1.01682675, 0.916566074, 0.837581098, 0.770276666,
+        0.707837522, 0.645979464, 0.582248449, 0.515372634, 0.444796771, 0.370383471, 0.292234689, 0.210589707 },
+    // ross~ driven
+    {
+        -0.0466983765, -0.0898598805, -0.133338124, -0.177070007, -0.220993519, -0.26504761, -0.309171975, -0.353307098,
+        -0.397393942, -0.441374004, -0.48518914, -0.528781593, -0.572093904, -0.615068793, -0.657649398, -0.699779034,
+        -0.741401374, -0.782460451, -0.822900593, -0.862666607, -0.901703835, -0.939958096, -0.977376044, -1.01390469,
+        -1.049492, -1.08408678, -1.11763871, -1.15009856, -1.18141806, -1.21155, -1.24044847, -1.26806891,
+        -1.29436815, -1.31930411, -1.34283662, -1.3649267, -1.38553739, -1.40463316, -1.42218018, -1.43814647,
+        -1.45250225, -1.46521938, -1.47627163, -1.48563492, -1.49328721, -1.49920869, -1.50338161, -1.50579047,
+        -1.50642204, -1.50526547, -1.50231194, -1.49755538, -1.49099183, -1.48261964, -1.47244, -1.46045625,
+        -1.44667423, -1.43110216, -1.41375101, -1.39463377, -1.37376666, -1.35116744, -1.32685709, -1.30085862,
+        -1.27319777, -1.24390268, -1.21300364, -1.18053365, -1.14652789, -1.11102414, -1.07406187, -1.03568375,
+        -0.995933831, -0.954858661, -0.912507057, -0.868929744, -0.82417959, -0.778311253, -0.731381536, -0.68344903,
+        -0.634573936, -0.584818363, -0.534246027, -0.482922107, -0.430913389, -0.378287971, -0.325115383, -0.271466315,
+        -0.217412665, -0.163027361, -0.108384281, -0.0535582155, 0.00137530267, 0.0563399941, 0.111259043, 0.166055158,
+        0.220650643, 0.274967551, 0.328927755, 0.382453024, 0.435465246, 0.487886429, 0.539638758, 0.590644956,
+        0.640828133, 0.690111876, 0.738420725, 0.785679698, 0.831815064, 0.876753926, 0.920424402, 0.962756217,
+        1.00368023, 1.04312861, 1.08103538, 1.11733603, 1.151968, 1.1848706, 1.21598494, 1.24525452,
+        1.27262473, 1.29804337, 1.32146084, 1.34282994, 1.36210597, 1.37924719, 1.39421427, 1.40697122,
+        1.41748488, 1.42572522, 1.4316653, 1.43528152, 1.43655407, 1.43546605, 1.43200433, 1.42615926,
+        1.41792548, 1.40730047, 1.39428616, 1.37888813, 1.36111569, 1.34098232, 1.31850481, 1.29370427,
+        1.26660562, 1.23723686, 1.2056303, 1.17182159, 1.13584971, 1.09775686, 1.05758905, 1.01539445,
+        0.971224725, 0.925134182, 0.877179861, 0.82742101, 0.775919676, 0.722740054, 0.667948544, 0.61161375,
+        0.553806424, 0.494599342, 0.434067369, 0.372287452, 0.309338361, 0.245301232, 0.180258855, 0.114296243,
+        0.0475003049, -0.0200400651, -0.0882341936, -0.156989574, -0.226211786, -0.295805037, -0.365671813, -0.435713142,
+        -0.505828738, -0.575917363, -0.645876527, -0.715603054, -0.784992993, -0.853941679, -0.922344267, -0.990095675,
+        -1.0570904, -1.12322366, -1.18839049, -1.25248623, -1.3154074, -1.3770504, -1.43731296, -1.49609411,
+        -1.5532937, -1.60881293, -1.66255462, -1.71442342, -1.76432574, -1.81216943, -1.85786498, -1.90132499,
+        -1.94246447, -1.98120117, -2.01745486, -2.05114889, -2.08220911, -2.11056423, -2.13614678, -2.15889239,
+        -2.17874002, -2.19563174, -2.2095139, -2.22033644, -2.22805333, -2.23262239, -2.23400521, -2.23216796,
+        -2.22708082, -2.21871829, -2.20705938, -2.19208765, -2.17379069, -2.15216064, -2.12719536, -2.09889627,
+        -2.06726956, -2.03232646, -1.99408329, -1.95256042, -1.90778351, -1.85978258, -1.80859303, -1.7542547,
+        -1.69681191, -1.63631451, -1.57281613, -1.50637603, -1.43705738, -1.36492825, -1.29006135, -1.21253383,
+        -1.13242722, -1.04982734, -0.964824319, -0.877512455, -0.787990391, -0.69636035, -0.602728665, -0.507205546,
+        -0.409904927, -0.31094408, -0.210443869, -0.108528428, -0.00532521307, 0.0990354121, 0.204419896, 0.310692132,
+        0.417713016, 0.525341094, 0.633432031, 0.741839767, 0.85041517, 0.959007382, 1.06746304, 1.17562652,
+        1.2833401, 1.39044333, 1.49677324, 1.60216379, 1.70644546, 1.80944419, 1.91098118, 2.01087022,
+        2.10891747, 2.20491695, 2.29864883, 2.38987279, 2.47832346, 2.56370044, 2.64565611, 2.72377992,
+        2.79757547, 2.86643124, 2.92957973, 2.98604321, 3.03456044, 3.07349443, 3.10071039, 3.11342955,
+        3.10805869, 3.08001781, 3.02360773, 2.93200088, 2.79750371, 2.63918972, 2.47888827, 2.31681323,
+        2.15318012, 1.98820782, 1.82211614, 1.65512729, 1.48746455, 1.31935203, 1.15101504, 0.982679009,
+        0.816322565, 0.656637788, 0.507713675, 0.372685552, 0.253556281, 0.151198864, 0.065507248, -0.00436758995,
+        -0.0597596914, -0.102254882, -0.133507803, -0.155115172, -0.168539628, -0.175072879, -0.175826013, -0.171736926,
+        -0.163586706, -0.152019769, -0.137565285, -0.120656379, -0.101647705, -0.0808307081, -0.0584457666, -0.0346927643,
+        -0.00973938406, 0.0162718594, 0.0432188064, 0.0709946305, 0.0995048583, 0.128664732, 0.158396736, 0.188629285,
+        0.219295233, 0.250330716, 0.281674623, 0.313267946, 0.345052838, 0.376972973, 0.4089728, 0.440997213,
+        0.472991705, 0.504902244, 0.536674798, 0.568255961, 0.599592268, 0.630630493, 0.661317825, 0.691601276,
+        0.721428633, 0.750747561, 0.779506624, 0.807654142, 0.835139215, 0.861911654, 0.887921393, 0.913119495,
+        0.937457502, 0.96088773, 0.983363509, 1.00483894, 1.02526927, 1.04461086, 1.06282115, 1.07985866,
+        1.09568369, 1.11025774, 1.1235441, 1.13550675, 1.14611244, 1.15532887, 1.16312599, 1.16947556,
+        1.17435122, 1.17772877, 1.17958641, 1.17990386, 1.17866373, 1.17585075, 1.17145228, 1.16545784,
+        1.15785933, 1.14865136, 1.13783121, 1.12539828, 1.11135507, 1.09570599, 1.07845855, 1.05962205,
+        1.03920889, 1.01723325, 0.993711829, 0.968663275, 0.942108929, 0.914071321, 0.884575725, 0.853648782,
+        0.821318805, 0.787616074, 0.752572179, 0.716220319, 0.678595364, 0.639733136, 0.599671483, 0.558449388,
+        0.516106963, 0.472685993, 0.42822963, 0.382782549, 0.336390525, 0.289101273, 0.240963414, 0.192027777,
+        0.142346382, 0.0919726193, 0.0409614481, -0.0106303617, -0.0627450272, -0.115322903, -0.16830349, -0.221624464,
+        -0.275222242, -0.32903263, -0.382989824, -0.437027574, -0.491078109, -0.545073509, -0.598944604, -0.652622283,
+        -0.70603621, -0.759116411, -0.811792135, -0.86399287, -0.915647864, -0.966686308, -1.01703787, -1.06663239,
+        -1.11539984, -1.16327107, -1.2101773, -1.25605035, -1.30082309, -1.34442914, -1.38680303, -1.42788064,
+        -1.46759892, -1.50589597, -1.5427115, -1.5779866, -1.61166358, -1.64368713, -1.67400348, -1.70256007,
+        -1.72930741, -1.75419688, -1.77718294, -1.79822147, -1.81727099, -1.83429241, -1.84924912, -1.86210656,
+        -1.87283313, -1.88139951, -1.88777947, -1.8919493, -1.893888, -1.89357758, -1.89100289, -1.88615155,
+        -1.87901437, -1.86958516, -1.85786057, -1.84384048, -1.827528, -1.80892909, -1.78805315, -1.76491225,
+        -1.73952222, -1.71190155, -1.68207216, -1.65005898, -1.6158905, -1.57959759, -1.54121482, -1.50077963,
+        -1.45833278, -1.4139179, -1.36758137, -1.31937289, -1.26934481, -1.21755266, -1.16405451, -1.10891128,
+        -1.05218649, -0.993946671, -0.934260368, -0.873198926, -0.810836017, -0.747247815, -0.682512343, -0.616710186,
+        -0.549923778, -0.482237458, -0.413737595, -0.344512165, -0.274650931, -0.20424509, -0.133387297, -0.0621715635 },
+    // ross~ dry
+    {
+        -0.124806896, -0.251426041, -0.379053533, -0.506909072, -0.634229362, -0.760263085, -0.884267509, -1.00550747,
+        -1.12325525, -1.23679233, -1.34541261, -1.44842505, -1.54515779, -1.63496208, -1.7172159, -1.79132819,
+        -1.85674274, -1.91294169, -1.95944929, -1.99583554, -2.02171874, -2.03676939, -2.04071212, -2.03332901,
+        -2.01446152, -1.98401153, -1.94194484, -1.88829088, -1.82314467, -1.74666667, -1.65908372, -1.56068885,
+        -1.45184064, -1.33296239, -1.20454133, -1.06712663, -0.92132771, -0.767811894, -0.607301831, -0.44057259,
+        -0.268448085, -0.0917977914, 0.0884672403, 0.271398574, 0.456014723, 0.641305685, 0.826237679, 1.009758,
+        1.19079947, 1.36828589, 1.54113579, 1.70826757, 1.86860275, 2.02106953, 2.16460466, 2.29815555,
+        2.42067885, 2.5311389, 2.62850285, 2.71173263, 2.77977633, 2.83155489, 2.86594868, 2.8817873,
+        2.87784457, 2.85285139, 2.80553532, 2.7347064, 2.63939691, 2.51907396, 2.37390471, 2.20504141,
+        2.01484156, 1.80692101, 1.58594108, 1.35710323, 1.12544286, 0.895119846, 0.668932378, 0.448194116,
+        0.232965648, 0.0225057006, -0.184234351, -0.38820976, -0.59003818, -0.789907336, -0.987594128, -1.18254232,
+        -1.37395859, -1.56089914, -1.74233711, -1.91720915, -2.08444548, -2.24298763, -2.39180303, -2.52989197,
+        -2.65629601, -2.77010489, -2.87046123, -2.95656824, -3.02769351, -3.08317566, -3.12242842, -3.14494562,
+        -3.15030527, -3.13817406, -3.10831022, -3.06056595, -2.99489188, -2.91133666, -2.81005001, -2.69128394,
+        -2.55539179, -2.40282893, -2.23415256, -2.05001926, -1.85118437, -1.63849866, -1.41290593, -1.17543912,
+        -0.92721647, -0.66943711, -0.403375804, -0.13037768, 0.148147628, 0.430732012, 0.715855122, 1.00195062,
+        1.28741217, 1.57059884, 1.84983969, 2.12343597, 2.38965988, 2.64674902, 2.89289069, 3.12619162,
+        3.34462214, 3.54592013, 3.72742319, 3.88578415, 4.0164957, 4.11310768, 4.16598797, 4.16048336,
+        4.07455349, 3.87670565, 3.52702713, 2.99569869, 2.46103334, 1.92584801, 1.39293265, 0.876218498,
+        0.429397404, 0.0802414864, -0.173701435, -0.352784872, -0.480591029, -0.576010883, -0.651635349, -0.714969158,
+        -0.770139337, -0.819249153, -0.863265395, -0.902545691, -0.937136829, -0.966935992, -0.991776824, -1.01147389,
+        -1.02584612, -1.03472865, -1.0379796, -1.03548396, -1.0271554, -1.01293826, -0.992808521, -0.966774702,
+        -0.934878469, -0.897194624, -0.853831947, -0.804932594, -0.750672519, -0.691260338, -0.626937628, -0.557977319,
+        -0.484683514, -0.40738976, -0.326458037, -0.24227719, -0.155261248, -0.0658475459, 0.0255052261, 0.118319228,
+        0.212099716, 0.306337595, 0.400511861, 0.494092405, 0.586542547, 0.677322268, 0.765890777, 0.851709843,
+        0.934246659, 1.01297688, 1.0873878, 1.15698195, 1.22127938, 1.27982152, 1.33217382, 1.37792945,
+        1.41671169, 1.4481777, 1.47202063, 1.48797345, 1.49581051, 1.49535167, 1.48646283, 1.46905899,
+        1.44310594, 1.40862024, 1.36567104, 1.31437862, 1.25491428, 1.18749881, 1.11240005, 1.02993083,
+        0.9404459, 0.844339371, 0.742042243, 0.63402003, 0.520771086, 0.402825236, 0.280742735, 0.155113116,
+        0.0265542269, -0.104289219, -0.236747533, -0.370128453, -0.503720045, -0.636794388, -0.768611133, -0.898421764,
+        -1.02547419, -1.14901662, -1.26830268, -1.38259554, -1.49117255, -1.59332919, -1.68838441, -1.77568388,
+        -1.85460508, -1.92456055, -1.98500252, -2.03542638, -2.07537413, -2.10443854, -2.1222651, -2.12855601,
+        -2.12307239, -2.10563707, -2.07613611, -2.0345211, -1.98081005, -1.91508937, -1.83751345, -1.74830616,
+        -1.64775991, -1.53623617, -1.41416383, -1.28203857, -1.14042127, -0.989935875, -0.831267476, -0.665158987,
+        -0.492408842, -0.313867152, -0.130432248, 0.0569534115, 0.247307464, 0.43961212, 0.632818878, 0.825853288,
+        1.01762009, 1.20700765, 1.39289331, 1.57414794, 1.74963951, 1.91823816, 2.07881761, 2.23025751,
+        2.37144327, 2.50126457, 2.61860991, 2.72235823, 2.8113656, 2.88444853, 2.94036078, 2.97776771,
+        2.99521804, 2.99112654, 2.96377182, 2.91133952, 2.83202815, 2.72425938, 2.58700776, 2.42024827,
+        2.22545362, 2.00599456, 1.76723266, 1.51611459, 1.26023245, 1.00657082, 0.760365844, 0.52448976,
+        0.299527287, 0.0843917727, -0.122843862, -0.324206322, -0.521332264, -0.715248942, -0.906357884, -1.09453475,
+        -1.27926874, -1.45979619, -1.63520515, -1.80450952, -1.96669519, -2.120749, -2.26567578, -2.40050936,
+        -2.52432156, -2.63622808, -2.73539495, -2.82104397, -2.89245939, -2.94899058, -2.99005938, -3.01516318,
+        -3.02387953, -3.01586962, -2.99088192, -2.94875598, -2.88942337, -2.81291056, -2.71934032, -2.60893345,
+        -2.48200798, -2.33898044, -2.18036461, -2.00677013, -1.81890202, -1.61755741, -1.40362334, -1.17807293,
+        -0.9419626, -0.696426749, -0.442673773, -0.181980699, 0.084312439, 0.354808271, 0.628058076, 0.902568102,
+        1.17680526, 1.4492029, 1.71816576, 1.98207319, 2.2392807, 2.48811674, 2.72687483, 2.95379329,
+        3.16702056, 3.3645525, 3.54412532, 3.70303607, 3.83784771, 3.94391108, 4.01461124, 4.04024506,
+        4.00649166, 3.89273214, 3.67127585, 3.31018686, 2.78448009, 2.23877096, 1.69381273, 1.1524334,
+        0.652938843, 0.239947245, -0.0728466362, -0.298162282, -0.459625483, -0.579432487, -0.673618019, -0.752176046,
+        -0.820748508, -0.882262468, -0.938088179, -0.988753319, -1.0343523, -1.07476926, -1.10979629, -1.13919377,
+        -1.16272247, -1.18015838, -1.19130206, -1.19598258, -1.19406128, -1.18543303, -1.17002821, -1.14781368,
+        -1.11879349, -1.08300984, -1.04054356, -0.991514087, -0.936079681, -0.874437213, -0.806821704, -0.733505845,
+        -0.654799044, -0.571046352, -0.482627362, -0.389954418, -0.293471217, -0.193650767, -0.0909933001, 0.0139759779,
+        0.120709293, 0.228639036, 0.337180436, 0.445734501, 0.553691149, 0.6604321, 0.765334487, 0.86777389,
+        0.967127979, 1.06277978, 1.15412116, 1.24055672, 1.32150698, 1.39641178, 1.46473479, 1.52596605,
+        1.57962608, 1.62526977, 1.66248941, 1.69091916, 1.71023774, 1.72017324, 1.72050607, 1.71107268,
+        1.69176805, 1.66254973, 1.62343836, 1.57452011, 1.51594579, 1.44793022, 1.370749, 1.28473556,
+        1.19027507, 1.08779991, 0.977783561, 0.860735834, 0.73719883, 0.607744217, 0.472972095, 0.333511204,
+        0.190019473, 0.0431848988, -0.106274009, -0.257608771, -0.410042614, -0.562773466, -0.714977682, -0.865815163,
+        -1.0144341, -1.15997648, -1.30158412, -1.43840337, -1.56959057, -1.69431818, -1.8117789, -1.9211911,
+        -2.02180386, -2.11290145, -2.19380879, -2.26389503, -2.32257891, -2.36933136, -2.40368128, -2.42521763,
+        -2.43359447, -2.42853212, -2.40982103, -2.37732482, -2.33098078, -2.27080297, -2.19688225, -2.10938883,
+        -2.00857091, -1.89475572, -1.76834941, -1.62983513, -1.47977293, -1.31879711, -1.14761448, -0.967002094,
+        -0.77780354, -0.580925882, -0.377335995, -0.16805625, 0.0458399467, 0.263233006, 0.482961893, 0.703829765 },
+    // ross~ euler
+    {
+        -0.0621255562, -0.125362679, -0.189296007, -0.253528953, -0.317677617, -0.381365836, -0.444221705, -0.505875826,
+        -0.565960765, -0.624111354, -0.67996639, -0.733170033, -0.783373773, -0.830238521, -0.873436689, -0.912654281,
+        -0.947592735, -0.977971315, -1.00352871, -1.02402484, -1.03924298, -1.0489912, -1.05310416, -1.05144405,
+        -1.04390264, -1.03040206, -1.01089609, -0.985370636, -0.953845203, -0.916372716, -0.873040378, -0.823969841,
+        -0.76931715, -0.709272623, -0.644060552, -0.573938608, -0.499197096, -0.420158267, -0.337174863, -0.250629038,
+        -0.160930857, -0.0685166568, 0.0261528306, 0.122594342, 0.220304236, 0.318760693, 0.41742596, 0.515748858,
+        0.613167048, 0.709109485, 0.802998722, 0.894253016, 0.98228848, 1.06652021, 1.14636385, 1.22123516,
+        1.29054976, 1.35372043, 1.41015315, 1.45924032, 1.50035131, 1.53281868, 1.55592108, 1.56886339,
+        1.57075334, 1.5605824, 1.53721702, 1.49941444, 1.44588447, 1.37542415, 1.28715277, 1.18085945,
+        1.05743015, 0.91925168, 0.770394981, 0.616346359, 0.463160723, 0.316199064, 0.17894356, 0.0524584651,
+        -0.064274773, -0.173431009, -0.277358741, -0.377929449, -0.476300925, -0.57297039, -0.667952538, -0.760965347,
+        -0.851570487, -0.939259887, -1.02350211, -1.10376406, -1.17952061, -1.25026035, -1.31548858, -1.3747313,
+        -1.42753768, -1.47348344, -1.51217365, -1.54324555, -1.56637096, -1.58125973, -1.58766103, -1.58536601,
+        -1.57421005, -1.55407429, -1.52488756, -1.48662746, -1.43932128, -1.38304746, -1.31793606, -1.24416864,
+        -1.16197896, -1.07165217, -0.97352469, -0.86798352, -0.755464733, -0.636452496, -0.511477172, -0.381113499,
+        -0.245978445, -0.106728755, 0.0359417126, 0.181304738, 0.328600794, 0.47704196, 0.625815153, 0.774084568,
+        0.920994878, 1.06567216, 1.20722556, 1.34474492, 1.47729683, 1.60391498, 1.72358024, 1.83518791,
+        1.93748951, 2.02899337, 2.10779858, 2.17131686, 2.21581769, 2.23569798, 2.22236729, 2.16269159,
+        2.03722668, 1.81938207, 1.57101858, 1.3125453, 1.045192, 0.770262659, 0.489130348, 0.223024219,
+        0.000604728877, -0.164746016, -0.278756857, -0.357350916, -0.415593565, -0.463148117, -0.504944623, -0.543108165,
+        -0.578389466, -0.610939801, -0.640672684, -0.667418361, -0.690984905, -0.711182594, -0.727832675, -0.740770996,
+        -0.749850631, -0.754942656, -0.755937994, -0.752747774, -0.745304704, -0.733563602, -0.717502475, -0.697122693,
+        -0.672449768, -0.643533647, -0.610448837, -0.57329452, -0.532194674, -0.487297744, -0.438776374, -0.386826992,
+        -0.331669122, -0.273544759, -0.212717459, -0.149471328, -0.0841099247, -0.0169549435, 0.0516550951, 0.121366382,
+        0.191811427, 0.262610704, 0.33337447, 0.403704643, 0.473196745, 0.541441798, 0.608028412, 0.672544837,
+        0.734580994, 0.793730676, 0.849593163, 0.901775718, 0.949895263, 0.993580282, 1.03247309, 1.06623101,
+        1.09452927, 1.11706221, 1.13354611, 1.14372182, 1.14735806, 1.1442554, 1.13425148, 1.11722767,
+        1.09311604, 1.06190801, 1.02366352, 0.978518426, 0.926691413, 0.868484855, 0.804281652, 0.734533668,
+        0.659743071, 0.580438018, 0.497145981, 0.410368979, 0.320566714, 0.228150532, 0.133489668, 0.0369272828,
+        -0.0611976609, -0.160529137, -0.260677785, -0.361212611, -0.461660862, -0.561513543, -0.660234272, -0.757268786,
+        -0.852052927, -0.944019556, -1.0326035, -1.11724544, -1.19739652, -1.27252102, -1.34209967, -1.40563381,
+        -1.46264744, -1.51269126, -1.5553453, -1.59022188, -1.61696899, -1.63527203, -1.64485717, -1.64549303,
+        -1.63699377, -1.61922014, -1.59208155, -1.55553794, -1.5096004, -1.45433235, -1.38985097, -1.31632662,
+        -1.23398352, -1.14309978, -1.04400671, -0.937088013, -0.822779119, -0.701565444, -0.573981225, -0.44060725,
+        -0.302068889, -0.159033582, -0.0122082736, 0.137663528, 0.289804697, 0.443407655, 0.597637475, 0.751634598,
+        0.904517889, 1.0553863, 1.20331931, 1.34737659, 1.48659205, 1.61996448, 1.74643779, 1.86486435,
+        1.97394347, 2.07211185, 2.15735865, 2.22691035, 2.27669978, 2.30049872, 2.28855038, 2.22559309,
+        2.08850431, 1.85624015, 1.61261058, 1.35873699, 1.09582078, 0.825138092, 0.54803431, 0.279612035,
+        0.0496761426, -0.124746248, -0.245786786, -0.328021169, -0.387100548, -0.433801353, -0.473916501, -0.510077357,
+        -0.543296337, -0.573853135, -0.601724565, -0.626774609, -0.648832321, -0.66772306, -0.68328023, -0.695350826,
+        -0.703797221, -0.708498895, -0.709353864, -0.706279218, -0.699212253, -0.688111067, -0.672955453, -0.653747201,
+        -0.630510688, -0.603293359, -0.572165549, -0.537220955, -0.498576283, -0.456371486, -0.410768986, -0.361953616,
+        -0.310131907, -0.255531341, -0.198399693, -0.139003962, -0.0776293874, -0.0145781841, 0.0498316996, 0.115268014,
+        0.181385726, 0.247828573, 0.314230829, 0.380218983, 0.445413709, 0.509431601, 0.571887195, 0.63239491,
+        0.69057101, 0.746035755, 0.798415124, 0.847343087, 0.892463386, 0.933431745, 0.969917655, 1.00160646,
+        1.02820158, 1.04942656, 1.06502724, 1.07477498, 1.07846951, 1.0759418, 1.06705928, 1.05172944,
+        1.0299052, 1.00159049, 0.966844499, 0.925786674, 0.878597975, 0.825521111, 0.766855955, 0.702951908,
+        0.634195685, 0.56099683, 0.483772874, 0.402935714, 0.318882704, 0.231993839, 0.142635047, 0.0511671118,
+        -0.0420429036, -0.136610255, -0.232124016, -0.328142852, -0.42419529, -0.519783676, -0.614389777, -0.707481623,
+        -0.798519075, -0.886959314, -0.97226119, -1.05388904, -1.13131583, -1.20402706, -1.27152348, -1.33332455,
+        -1.38897121, -1.43802929, -1.48009205, -1.51478338, -1.54176033, -1.56071568, -1.57138062, -1.57352674,
+        -1.56696832, -1.55156422, -1.52721965, -1.49388742, -1.45156944, -1.40031755, -1.34023452, -1.271474,
+        -1.19424152, -1.1087935, -1.01543784, -0.914532602, -0.806485176, -0.69175142, -0.570833802, -0.44427973,
+        -0.312679708, -0.176664799, -0.0369043164, 0.105897039, 0.251001954, 0.397643536, 0.545028329, 0.692339122,
+        0.838738084, 0.983368516, 1.12535655, 1.26381099, 1.39782095, 1.5264492, 1.64871967, 1.76359344,
+        1.86992729, 1.96640348, 2.0514102, 2.12284184, 2.17777109, 2.21191692, 2.21881175, 2.18857622,
+        2.10632563, 1.95068932, 1.70768964, 1.45393038, 1.19060183, 0.918971419, 0.640379071, 0.359494328,
+        0.108298026, -0.0898200721, -0.230701715, -0.326653212, -0.394569397, -0.447315037, -0.492159098, -0.532487988,
+        -0.569630861, -0.603976607, -0.635526061, -0.664135635, -0.689616442, -0.711773157, -0.730418146, -0.745377481,
+        -0.756493449, -0.763626337, -0.766655803, -0.765481412, -0.760024428, -0.750228047, -0.736058474, -0.717505693,
+        -0.694583595, -0.667330742, -0.635810733, -0.600112021, -0.560348153, -0.51665777, -0.469204068, -0.418174714,
+        -0.363781035, -0.306257576, -0.245861143, -0.182869911, -0.117582351, -0.0503159761, 0.018593967, 0.0887959823,
+        0.159923837, 0.231598303, 0.303428888, 0.375015706, 0.445951313, 0.515822887, 0.584213912, 0.650706649,
+        0.714883983, 0.776331306, 0.834638953, 0.889403939, 0.940232038, 0.986739755, 1.02855587, 1.06532383 },
+    // ross~ rk4
+    {
+        -0.253247082, -0.499219507, -0.714713335, -0.878297269, -0.972026348, -0.98332119, -0.906494498, -0.74321717,
+        -0.501618683, -0.197621226, 0.142631099, 0.489129871, 0.811094642, 1.07705164, 1.2569654, 1.3232584,
+        1.25171483, 1.03239, 0.697642982, 0.313083172, -0.0817340612, -0.475286186, -0.845949173, -1.16023147,
+        -1.37938237, -1.42216527, -0.916120708, -0.638298273, -0.502642572, -0.379292727, -0.255137146, -0.0774070621,
+        0.269522667, 0.741642177, 1.2040832, 1.55075574, 1.59648073, 1.00565255, 0.318336576, 0.110429093,
+        0.136219844, 0.208122581, 0.281217396, 0.337785304, 0.368505597, 0.368104696, 0.334508359, 0.268759072,
+        0.174936101, 0.0598878078, -0.0672451258, -0.195702955, -0.313957185, -0.410693496, -0.475848496, -0.501603127,
+        -0.483234644, -0.419739962, -0.314158618, -0.173548818, -0.00859751366, 0.167123079, 0.33820653, 0.488697588,
+        0.603519619, 0.66994518, 0.679002166, 0.626658678, 0.514519691, 0.349765301, 0.144429624, -0.0855037794,
+        -0.321023762, -0.541354239, -0.725693703, -0.855159163, -0.914653301, -0.894481659, -0.791598916, -0.610408723,
+        -0.362840623, -0.0673408955, 0.252304822, 0.568240523, 0.850930691, 1.07152545, 1.20379448, 1.22573864,
+        1.12296987, 0.898988008, 0.584926605, 0.222007081, -0.163034648, -0.549477935, -0.907935321, -1.20435619,
+        -1.40284765, -1.43777633, -1.02140272, -0.624308944, -0.472497761, -0.339611173, -0.209159762, 0.0245924406,
+        0.432089299, 0.918126106, 1.3558073, 1.62480807, 1.45433354, 0.67833662, 0.151547238, 0.101921313,
+        0.172402263, 0.264840841, 0.348359436, 0.408130646, 0.435342133, 0.425000787, 0.375688851, 0.289602697,
+        0.172419593, 0.0329130292, -0.11765971, -0.266383708, -0.399716586, -0.504665315, -0.570002139, -0.587399781,
+        -0.552372217, -0.464923114, -0.32982564, -0.15648675, 0.0416155271, 0.24789688, 0.443970501, 0.611194074,
+        0.732351482, 0.793372095, 0.785007179, 0.704288363, 0.555270255, 0.348479956, 0.0994737148, -0.172289297,
+        -0.444214523, -0.691988409, -0.891766965, -1.02248704, -1.06792879, -1.01832819, -0.871722877, -0.636322021,
+        -0.33171615, 0.019340992, 0.391959667, 0.752378643, 1.06509304, 1.29580092, 1.4108851, 1.37394047,
+        1.1519351, 0.772256076, 0.348857373, -0.0480155945, -0.425585389, -0.779712379, -1.08134246, -1.29252577,
+        -1.33330059, -0.888036847, -0.644734323, -0.516271055, -0.397012562, -0.275553584, -0.124445222, 0.188742816,
+        0.647934318, 1.12077534, 1.49941373, 1.62700367, 1.1644268, 0.407376528, 0.105461322, 0.116369337,
+        0.189379632, 0.269162714, 0.334974468, 0.376043648, 0.386001527, 0.361764252, 0.303448558, 0.214353144,
+        0.10075298, -0.0285281148, -0.162752286, -0.29009369, -0.398622513, -0.477374882, -0.517409921, -0.512750626,
+        -0.461112916, -0.364344299, -0.22851336, -0.0636225641, 0.117053777, 0.297968507, 0.462569326, 0.594744384,
+        0.680345774, 0.708689928, 0.673903346, 0.575866163, 0.420398474, 0.218612194, -0.0140714645, -0.258822113,
+        -0.49450922, -0.699361742, -0.852968872, -0.938267648, -0.943309188, -0.862674117, -0.698508441, -0.461009979,
+        -0.16751644, 0.159122884, 0.491181135, 0.798187971, 1.04965794, 1.21706557, 1.27512276, 1.20371032,
+        0.99757266, 0.684913337, 0.31733942, -0.0707086772, -0.462503314, -0.833250225, -1.14934099, -1.3742547,
+        -1.44491744, -1.08368754, -0.636666417, -0.495884031, -0.369801223, -0.24390249, -0.0520440154, 0.311559856,
+        0.78865695, 1.24537206, 1.57416415, 1.57105494, 0.918852687, 0.274543405, 0.112895995, 0.148481116,
+        0.222641394, 0.295015544, 0.349074066, 0.375974149, 0.370812893, 0.331925929, 0.260815799, 0.162043661,
+        0.0429245755, -0.0869862884, -0.216603205, -0.334194899, -0.428395212, -0.489255428, -0.509238303, -0.484054893,
+        -0.413257778, -0.300521225, -0.153564662, 0.0162956323, 0.194948554, 0.36659357, 0.515070736, 0.625321448,
+        0.684879065, 0.685280323, 0.623226821, 0.501201808, 0.327279985, 0.114311814, -0.120998107, -0.359032482,
+        -0.578601539, -0.75876081, -0.880789459, -0.930057943, -0.897617936, -0.781411111, -0.587034881, -0.327680737,
+        -0.0228786077, 0.302619934, 0.620140731, 0.899653614, 1.11210275, 1.23120701, 1.23494101, 1.10964882,
+        0.862805843, 0.531902254, 0.15978834, -0.229220867, -0.614763796, -0.966466427, -1.24989283, -1.42654395,
+        -1.40531909, -0.797349155, -0.590557814, -0.455099523, -0.328361958, -0.201142594, 0.0421033911, 0.456664979,
+        0.941287518, 1.37234616, 1.62786472, 1.4301132, 0.650271773, 0.144404173, 0.100873314, 0.169513866,
+        0.258408844, 0.338219732, 0.394816577, 0.419819415, 0.408530116, 0.359699845, 0.275561035, 0.161694288,
+        0.0266533103, -0.118634224, -0.261675, -0.389412224, -0.489362895, -0.550788522, -0.565783083, -0.530171096,
+        -0.444120586, -0.312398851, -0.144226715, 0.0472789407, 0.246049494, 0.434332967, 0.594195068, 0.709147394,
+        0.765805364, 0.755481422, 0.675522923, 0.529946029, 0.328929245, 0.0875630975, -0.175191939, -0.437364668,
+        -0.67543143, -0.866422534, -0.990139008, -1.03115928, -0.980464339, -0.836765289, -0.608066261, -0.311790198,
+        0.0299508981, 0.390732169, 0.738036096, 1.03807664, 1.25823164, 1.36745143, 1.33494639, 1.13662195,
+        0.794141769, 0.392980456, -0.00474786758, -0.393219918, -0.762501001, -1.08243692, -1.31564319, -1.39178324,
+        -1.00914991, -0.65531075, -0.522882879, -0.402575433, -0.280753493, -0.136946201, 0.166905195, 0.622160912,
+        1.09831715, 1.48562026, 1.63220263, 1.2006067, 0.432184935, 0.107401058, 0.115884021, 0.190947175,
+        0.273934335, 0.34304902, 0.386989295, 0.399027526, 0.375821084, 0.317327321, 0.226793647, 0.110555112,
+        -0.0223971512, -0.161058843, -0.293253154, -0.40663892, -0.489813566, -0.533408999, -0.531072259, -0.480232716,
+        -0.382572025, -0.244136333, -0.0750603303, 0.111096725, 0.298365414, 0.46966204, 0.608272433, 0.699422061,
+        0.73183465, 0.699155092, 0.600985169, 0.443122327, 0.236860693, -0.00208316254, -0.254476875, -0.498634577,
+        -0.712089181, -0.873661637, -0.965521216, -0.975014091, -0.896130502, -0.730653226, -0.488907099, -0.18870312,
+        0.146969497, 0.489920557, 0.808661819, 1.07156801, 1.24877024, 1.31301665, 1.24078846, 1.02327597,
+        0.692676008, 0.312073827, -0.0803631544, -0.47237581, -0.841825664, -1.15532184, -1.37479532, -1.42405915,
+        -0.956934154, -0.640585124, -0.501829386, -0.377109289, -0.252156794, -0.0707214475, 0.280824244, 0.754592419,
+        1.21573806, 1.55777729, 1.59022462, 0.980725288, 0.30642876, 0.11233288, 0.141012788, 0.213576764,
+        0.286383867, 0.34204632, 0.37138626, 0.369254112, 0.333720744, 0.265995175, 0.170333147, 0.0537554435,
+        -0.0744427964, -0.203378767, -0.321445286, -0.417304158, -0.480929196, -0.504600048, -0.48374936, -0.4175753,
+        -0.30934912, -0.166372225, 0.000435213267, 0.177299291, 0.348663658, 0.498491585, 0.611706138, 0.675668657,
+        0.681586981, 0.625693321, 0.509912372, 0.341753811, 0.133554637, -0.0984329581, -0.334970087, -0.55512166,
+        -0.73802489, -0.864847302, -0.920654893, -0.896019936, -0.788253784, -0.602193952, -0.350233495, -0.0512238964 },
+    // ross~ semi
+    {
+        -0.0310627781, -0.0466786921, -0.0624890029, -0.078466773, -0.0945862457, -0.110822521, -0.127151221, -0.143548399,
+        -0.159990236, -0.176453099, -0.192913339, -0.209347248, -0.225731134, -0.242041156, -0.258253336, -0.274343789,
+        -0.290288359, -0.306062907, -0.321643293, -0.337005377, -0.352124929, -0.36697793, -0.381540418, -0.395788401,
+        -0.409698248, -0.423246264, -0.436409146, -0.449163973, -0.46148783, -0.473358333, -0.48475346, -0.495651424,
+        -0.506031036, -0.515871465, -0.525152624, -0.533854485, -0.541958213, -0.549445033, -0.556297183, -0.562497437,
+        -0.568029046, -0.572876573, -0.577024937, -0.580459714, -0.583167672, -0.585136354, -0.586353898, -0.586809814,
+        -0.586494029, -0.585397959, -0.583513558, -0.58083415, -0.577353716, -0.573067427, -0.567971706, -0.562063813,
+        -0.555342197, -0.547806501, -0.539457321, -0.530296326, -0.520326614, -0.5095523, -0.497978479, -0.485611707,
+        -0.472459465, -0.458530515, -0.443834752, -0.428383321, -0.412188292, -0.395263255, -0.377622724, -0.359282106,
+        -0.340258569, -0.320569962, -0.300235152, -0.279274583, -0.257709295, -0.23556152, -0.212854862, -0.189613432,
+        -0.16586259, -0.141628861, -0.116939306, -0.0918221176, -0.0663065165, -0.0404221565, -0.0142000467, 0.0123282075,
+        0.0391305387, 0.066173926, 0.0934242904, 0.12084765, 0.148408905, 0.176072434, 0.203802407, 0.231562227,
+        0.259314924, 0.287023157, 0.314649165, 0.342155188, 0.369503081, 0.39665392, 0.423569918, 0.450211942,
+        0.47654143, 0.502519667, 0.528108358, 0.553268492, 0.57796222, 0.602151453, 0.625797868, 0.648864567,
+        0.671314061, 0.69310981, 0.714215517, 0.734595656, 0.754215181, 0.773039579, 0.791035175, 0.808169007,
+        0.824409187, 0.839724064, 0.8540833, 0.867457867, 0.879818976, 0.891139507, 0.901393175, 0.910555124,
+        0.918601573, 0.925509989, 0.931259513, 0.935830355, 0.939204216, 0.941364169, 0.942295492, 0.941984653,
+        0.940419972, 0.937591076, 0.933490276, 0.928111196, 0.921449184, 0.913502336, 0.904270291, 0.893754363,
+        0.881958663, 0.868889034, 0.85455364, 0.838962555, 0.822127938, 0.804064035, 0.784787357, 0.764315844,
+        0.742669702, 0.719870985, 0.695943058, 0.670911312, 0.644802213, 0.617644072, 0.589465976, 0.560298681,
+        0.530173779, 0.49912414, 0.46718353, 0.434386402, 0.400768638, 0.366366535, 0.331217706, 0.295360357,
+        0.258833885, 0.221678227, 0.183934838, 0.145646006, 0.106854647, 0.0676052868, 0.0279431045, -0.0120856166,
+        -0.0524337888, -0.0930529684, -0.133893877, -0.174906224, -0.216039211, -0.25724107, -0.29845956, -0.339640975,
+        -0.380732596, -0.421679318, -0.462426901, -0.502920747, -0.543105245, -0.582925379, -0.622325957, -0.661251545,
+        -0.699646592, -0.737456262, -0.774626017, -0.811101079, -0.846827507, -0.881751776, -0.915821314, -0.948983729,
+        -0.981186926, -1.01238048, -1.04251492, -1.07154155, -1.09941196, -1.12608016, -1.15150011, -1.17562819,
+        -1.198421, -1.21983755, -1.23983765, -1.25838339, -1.27543759, -1.29096484, -1.30493224, -1.31730795,
+        -1.32806277, -1.33716834, -1.34459949, -1.35033107, -1.35434258, -1.35661447, -1.3571285, -1.35586953,
+        -1.35282528, -1.34798419, -1.34133792, -1.3328805, -1.32260835, -1.31051993, -1.29661644, -1.28090119,
+        -1.26338053, -1.24406266, -1.22295856, -1.20008123, -1.17544699, -1.14907396, -1.12098312, -1.09119761,
+        -1.05974317, -1.02664781, -0.991942763, -0.955660582, -0.917836428, -0.878508449, -0.837716818, -0.795503616,
+        -0.751913428, -0.706993341, -0.660791993, -0.613360643, -0.564752519, -0.515022635, -0.464228064, -0.412428021,
+        -0.359683126, -0.306055963, -0.251611054, -0.196413994, -0.140532255, -0.0840347707, -0.0269920826, 0.0305247009,
+        0.0884425342, 0.146687299, 0.205184445, 0.263857841, 0.322630703, 0.381425202, 0.440163732, 0.498766899,
+        0.557156324, 0.615251303, 0.672972739, 0.730240345, 0.786973596, 0.843093038, 0.898518443, 0.953169763,
+        1.00696778, 1.05983448, 1.11169004, 1.16245687, 1.21205842, 1.26041782, 1.30746031, 1.35311091,
+        1.39729631, 1.43994379, 1.48098326, 1.52034318, 1.55795574, 1.59375358, 1.62767029, 1.65964115,
+        1.68960297, 1.71749365, 1.74325311, 1.76682281, 1.78814268, 1.8071574, 1.82380974, 1.83804488,
+        1.8498069, 1.85904253, 1.86569619, 1.8697145, 1.87104249, 1.86962342, 1.86540222, 1.85832214,
+        1.84832513, 1.83535242, 1.81934643, 1.80024827, 1.77800131, 1.75255108, 1.72384799, 1.6918503,
+        1.65652621, 1.61785567, 1.5758388, 1.5304966, 1.48187602, 1.43005633, 1.37514997, 1.31730676,
+        1.25671458, 1.19359958, 1.12822008, 1.06086397, 0.991838515, 0.921455264, 0.850019693, 0.777819395,
+        0.705115438, 0.632136703, 0.559073985, 0.486079067, 0.413266808, 0.340715915, 0.268475473, 0.196570158,
+        0.125006139, 0.0537772477, -0.0171285868, -0.0877250433, -0.158023179, -0.228027731, -0.297735602, -0.367133975,
+        -0.436200052, -0.504900932, -0.573193967, -0.641027868, -0.708343565, -0.775075018, -0.841150999, -0.906495214,
+        -0.971028686, -1.03466892, -1.097332, -1.15893281, -1.21938598, -1.27860475, -1.33650398, -1.39299905,
+        -1.4480052, -1.50143933, -1.55321956, -1.60326612, -1.65149999, -1.69784474, -1.74222565, -1.78456926,
+        -1.82480586, -1.86286688, -1.89868629, -1.93220139, -1.96335149, -1.99207902, -2.01832795, -2.0420475,
+        -2.0631876, -2.08170366, -2.09755206, -2.11069417, -2.12109375, -2.12871838, -2.13353848, -2.13552999,
+        -2.13466954, -2.13094091, -2.12432814, -2.11482239, -2.10241485, -2.08710527, -2.06889272, -2.04778242,
+        -2.02378464, -1.99691093, -1.96717882, -1.93460977, -1.89922774, -1.86106288, -1.8201468, -1.7765162,
+        -1.73021293, -1.68128085, -1.62976861, -1.57572806, -1.5192163, -1.4602921, -1.39902031, -1.3354671,
+        -1.26970279, -1.20180213, -1.13184321, -1.05990613, -0.986075759, -0.910438716, -0.83308661, -0.754111886,
+        -0.673609912, -0.591681004, -0.508425772, -0.423949033, -0.338356555, -0.251757681, -0.164262593, -0.0759850144,
+        0.0129615664, 0.102459878, 0.192392498, 0.282639563, 0.373080432, 0.46359396, 0.554057002, 0.644345701,
+        0.734336257, 0.823903382, 0.912922502, 1.00126827, 1.08881509, 1.17543793, 1.26101172, 1.34541178,
+        1.42851424, 1.51019585, 1.5903337, 1.66880643, 1.74549329, 1.82027483, 1.89303243, 1.9636488,
+        2.03200817, 2.09799552, 2.16149783, 2.22240305, 2.28059983, 2.33597779, 2.38842654, 2.43783569,
+        2.48409438, 2.52708912, 2.56670356, 2.6028192, 2.63530922, 2.6640408, 2.68886995, 2.70963955,
+        2.72617435, 2.73827982, 2.74573207, 2.74827862, 2.74562645, 2.73744059, 2.72333622, 2.70287561,
+        2.67556882, 2.64087343, 2.59821081, 2.54698372, 2.48661184, 2.41657972, 2.33650875, 2.2462337,
+        2.145895, 2.03602505, 1.91760838, 1.79210579, 1.66140902, 1.52772832, 1.39337623, 1.26049352,
+        1.13087487, 1.00586224, 0.886313975, 0.772628367, 0.664818466, 0.562602043, 0.465496987, 0.372911692,
+        0.284212947, 0.198777422, 0.116030701, 0.0354631916, -0.0433559567, -0.120777898, -0.197077677, -0.272463679 },
+    // ross~ dopri
+    {
+        -0.499160826, -0.878238857, -0.982675552, -0.739776492, -0.194997072, 0.489307761, 1.0767225, 1.32228792,
+        1.02967668, 0.310095906, -0.476539254, -1.16037738, -1.50412738, -1.3395586, -0.66296804, 0.341681242,
+        1.34352005, 1.90160406, 0.614460111, -0.269410938, -0.425177991, -0.4280864, -0.274021238, -3.76676544e-05,
+        0.308156788, 0.541269779, 0.603940964, 0.453055143, 0.11997585, -0.295855105, -0.65410465, -0.817085147,
+        -0.700742424, -0.312708467, 0.238605261, 0.770286202, 1.08004379, 1.01401782, 0.557849169, -0.126025021,
+        -0.832375884, -1.32097328, -1.38656652, -0.951896787, -0.113433324, 0.870971859, 1.64517248, 1.60956955,
+        0.0534333363, -0.415911645, -0.614203572, -0.609902501, -0.381236732, 0.0159895029, 0.456764936, 0.783444643,
+        0.859228611, 0.626339138, 0.142389223, -0.446267188, -0.943284869, -1.1565994, -0.972522616, -0.408581913,
+        0.375830114, 1.11798847, 1.51637936, 1.18884504, 0.225945532, -0.498907089, -1.06025076, -1.30231988,
+        -1.09721947, -0.463875622, 0.41894275, 1.25522923, 1.68691194, 0.999499321, -0.101445638, -0.595376492,
+        -0.895143449, -0.903893352, -0.582159698, -0.00650678109, 0.643074036, 1.13347268, 1.24433899, 0.84945029,
+        0.13196975, -0.644806385, -1.27368164, -1.51442742, -1.23010015, -0.458822429, 0.57730788, 1.52502823,
+        1.86736465, 0.24704963, -0.312050462, -0.439446032, -0.415254116, -0.235503718, 0.0532358512, 0.358417273,
+        0.569580436, 0.597176313, 0.409748286, 0.0517715625, -0.367320716, -0.70326364, -0.823179007, -0.656142831,
+        -0.227416441, 0.338312864, 0.849179864, 1.10481787, 0.966110408, 0.452828646, -0.253608227, -0.942917764,
+        -1.37234581, -1.35251808, -0.834149241, 0.0553061962, 1.03459799, 1.73333871, 1.38262272, -0.0943391025,
+        -0.461380333, -0.618120372, -0.566845894, -0.301114082, 0.108393788, 0.528925776, 0.805999875, 0.817725539,
+        0.530167937, 0.0208152533, -0.553931773, -0.996505439, -1.12909734, -0.864228368, -0.249067098, 0.534279227,
+        1.21565735, 1.49775457, 1.02135658, 0.105983749, -0.611868024, -1.15883398, -1.34919631, -1.06870484,
+        -0.360945642, 0.567719579, 1.39899349, 1.73006904, 0.64338398, -0.256474435, -0.633682847, -0.811407447,
+        -0.713664293, -0.341819853, 0.201972291, 0.738763809, 1.06641889, 1.02673709, 0.593708813, -0.0793789923,
+        -0.789236009, -1.29732633, -1.39352739, -0.990762174, -0.173954412, 0.808453262, 1.60576177, 1.66763115,
+        0.12792097, -0.396177471, -0.612669051, -0.628568053, -0.415775776, -0.0237426013, 0.425828695, 0.7738837,
+        0.877204776, 0.667742908, 0.19439742, -0.40026781, -0.920493126, -1.16823757, -1.01865411, -0.476626158,
+        0.3081429, 1.07598126, 1.5222652, 1.25489581, 0.265257388, -0.460119843, -1.0157907, -1.26735926,
+        -1.08575714, -0.483074784, 0.372303218, 1.19533706, 1.644943, 1.12037086, -0.00382396346, -0.568346858,
+        -0.940737188, -1.0143404, -0.72512722, -0.133598641, 0.58065933, 1.16713786, 1.36867332, 0.968386412,
+        0.18093884, -0.597104073, -1.23131096, -1.49342632, -1.24085987, -0.501392424, 0.514612377, 1.4638133,
+        1.86993408, 0.3580091, -0.31340152, -0.46585393, -0.458090782, -0.281107217, 0.0212483816, 0.353494823,
+        0.596825361, 0.650219917, 0.471863031, 0.101688594, -0.348743379, -0.726558685, -0.885050714, -0.738761544,
+        -0.303082317, 0.298275918, 0.863992929, 1.17493141, 1.06246328, 0.527217686, -0.209745765, -0.93755734,
+        -1.41178799, -1.42794693, -0.922445238, -0.0150578823, 1.01043701, 1.77091253, 1.40300453, -0.141993314,
+        -0.419870734, -0.498053044, -0.402400613, -0.147025168, 0.19425568, 0.506522775, 0.670711935, 0.608084083,
+        0.31655255, -0.123146437, -0.570447087, -0.864063382, -0.877520025, -0.570758402, -0.0161277913, 0.613375604,
+        1.09259248, 1.2103169, 0.850465894, 0.163210332, -0.606472254, -1.24229074, -1.50233459, -1.24417377,
+        -0.497190237, 0.525726676, 1.47841239, 1.87458515, 0.330892026, -0.30783686, -0.452488273, -0.441304445,
+        -0.266625881, 0.0278253257, 0.348771989, 0.581177473, 0.628199458, 0.450919718, 0.0894217044, -0.347033024,
+        -0.709809422, -0.85751313, -0.709170759, -0.282031834, 0.301983565, 0.846863985, 1.1413517, 1.02811134,
+        0.511732519, -0.20942843, -0.924943089, -1.39012992, -1.40404737, -0.904777706, -0.0108961267, 0.997888505,
+        1.745435, 1.4350698, -0.123033427, -0.44060564, -0.545453846, -0.462367415, -0.199144587, 0.170100018,
+        0.522671103, 0.725968242, 0.686113358, 0.391119003, -0.0784859657, -0.574936271, -0.922108114, -0.974576592,
+        -0.676148176, -0.0922218561, 0.598257124, 1.15144944, 1.32364941, 0.93405503, 0.179716468, -0.602935314,
+        -1.24572313, -1.51227558, -1.25779438, -0.50996089, 0.518602133, 1.48033476, 1.88454092, 0.316421926,
+        -0.315279663, -0.442923486, -0.416310906, -0.233435735, 0.0580530614, 0.364555418, 0.574928343, 0.599649072,
+        0.408113182, 0.0461778864, -0.375313759, -0.711038768, -0.827866912, -0.655638158, -0.221255898, 0.348573536,
+        0.860232115, 1.1123513, 0.965956151, 0.444382638, -0.266797543, -0.956554353, -1.38151693, -1.35330379,
+        -0.825204313, 0.071917139, 1.0536679, 1.74652708, 1.34723699, -0.116065077, -0.464559615, -0.607933283,
+        -0.545448899, -0.274943799, 0.130319223, 0.538004339, 0.797297001, 0.792566538, 0.49649173, -0.0105241537,
+        -0.571935058, -0.993050814, -1.10275638, -0.821777523, -0.204060972, 0.565592349, 1.21978259, 1.4693532,
+        0.992099524, 0.107743345, -0.626077354, -1.19120884, -1.39021802, -1.104424, -0.377594203, 0.57865274,
+        1.43657434, 1.76642752, 0.515718639, -0.301340878, -0.602719009, -0.710149884, -0.570419431, -0.203848064,
+        0.28332001, 0.726442575, 0.954153955, 0.851738334, 0.425976694, -0.193145454, -0.812842965, -1.21165085,
+        -1.21621859, -0.775286376, 0.00540441275, 0.880990028, 1.53016925, 1.51967418, 0.360065073, -0.359805197,
+        -0.816153646, -1.0263387, -0.886452854, -0.403824687, 0.287368119, 0.957949162, 1.34742284, 1.21056497,
+        0.512438059, -0.282532483, -1.00267255, -1.44340646, -1.41027105, -0.855743408, 0.0823383927, 1.10621667,
+        1.82098424, 1.19964504, -0.184321791, -0.421085596, -0.480846405, -0.371060252, -0.111278974, 0.221823215,
+        0.514747977, 0.654217362, 0.570207298, 0.268814027, -0.164881587, -0.590487421, -0.852419376, -0.834486008,
+        -0.508169353, 0.0454922877, 0.651182771, 1.08938432, 1.16278231, 0.782471538, 0.10150101, -0.655990899,
+        -1.2629683, -1.48302007, -1.18690753, -0.418201536, 0.600087404, 1.51912165, 1.83622301, 0.235315353,
+        -0.34809491, -0.48966521, -0.463632822, -0.264094174, 0.0573837385, 0.397820562, 0.633923948, 0.665361643,
+        0.456989378, 0.0590656213, -0.406929433, -0.781059027, -0.915471733, -0.73093617, -0.255086511, 0.373811305,
+        0.942328811, 1.22467268, 1.05017138, 0.451175153, -0.31090647, -1.03010106, -1.46105051, -1.41044307,
+        -0.836174905, 0.116937801, 1.14485216, 1.84523797, 1.09839392, -0.193136334, -0.410740256, -0.461065948,
+        -0.347980261, -0.0929518566, 0.228077337, 0.505143881, 0.630431056, 0.539485335, 0.241564423, -0.178636596 },
+    // ross~ dopri driven
+    {
+        -0.0467898063, -0.090004988, -0.133494586, -0.177190721, -0.221026421, -0.264935493, -0.308852434, -0.352712423,
+        -0.396451086, -0.440004587, -0.483309567, -0.526302993, -0.568922281, -0.611105204, -0.65279001, -0.693915308,
+        -0.73442024, -0.774244487, -0.813328266, -0.851612389, -0.889038444, -0.925548673, -0.961086452, -0.995595813,
+        -1.02902186, -1.06131089, -1.09241021, -1.12226844, -1.15083563, -1.17806292, -1.20390344, -1.22831142,
+        -1.251243, -1.27265573, -1.29250932, -1.31076503, -1.32738626, -1.34233832, -1.35558844, -1.3671062,
+        -1.376863, -1.38483286, -1.39099181, -1.39531827, -1.39779317, -1.39839959, -1.39712334, -1.39395249,
+        -1.38887787, -1.38189292, -1.37299323, -1.36217761, -1.34944713, -1.33480549, -1.31825948, -1.29981792,
+        -1.27949297, -1.25729918, -1.23325384, -1.20737696, -1.17969108, -1.15022171, -1.11899674, -1.08604693,
+        -1.05140555, -1.01510859, -0.97719419, -0.93770355, -0.896680117, -0.854169786, -0.810220778, -0.764883876,
+        -0.718212068, -0.670260489, -0.621086657, -0.570750117, -0.519312441, -0.466837198, -0.413389951, -0.359038055,
+        -0.303850591, -0.247898415, -0.191253915, -0.133990943, -0.0761848539, -0.0179122984, 0.0407488495, 0.0997195691,
+        0.158919841, 0.218268663, 0.277684212, 0.337084025, 0.396384895, 0.455503225, 0.514354885, 0.572855592,
+        0.630920768, 0.688465834, 0.74540627, 0.801657677, 0.857136011, 0.91175735, 0.965438604, 1.01809716,
+        1.06965101, 1.1200192, 1.1691215, 1.21687889, 1.26321352, 1.30804873, 1.35130918, 1.39292121,
+        1.43281269, 1.47091305, 1.50715375, 1.54146791, 1.57379091, 1.60406005, 1.63221514, 1.65819812,
+        1.68195331, 1.70342779, 1.72257137, 1.73933661, 1.75367904, 1.76555741, 1.77493334, 1.78177238,
+        1.78604352, 1.78771949, 1.78677678, 1.78319645, 1.77696359, 1.76806819, 1.75650489, 1.74227297,
+        1.72537744, 1.70582819, 1.68364072, 1.65883613, 1.63144076, 1.60148704, 1.5690124, 1.53406,
+        1.49667788, 1.45691895, 1.41484082, 1.37050498, 1.32397664, 1.27532399, 1.22461832, 1.17193246,
+        1.11734116, 1.06092036, 1.00274658, 0.942896843, 0.881448448, 0.818478703, 0.754064918, 0.688284516,
+        0.621215105, 0.552934468, 0.483521134, 0.413054466, 0.341614813, 0.26928407, 0.196145564, 0.122284643,
+        0.0477885455, -0.0272532701, -0.102749325, -0.178605974, -0.254727274, -0.331015527, -0.407370985, -0.483692139,
+        -0.559876025, -0.635818481, -0.711414158, -0.78655684, -0.861139655, -0.935055137, -1.008196, -1.08045471,
+        -1.15172374, -1.22189641, -1.29086637, -1.3585279, -1.42477643, -1.48950839, -1.5526216, -1.61401534,
+        -1.67359042, -1.73124945, -1.78689671, -1.84043908, -1.89178538, -1.94084668, -1.98753655, -2.03177142,
+        -2.07347059, -2.11255622, -2.14895296, -2.18258953, -2.2133975, -2.24131179, -2.26627111, -2.28821802,
+        -2.30709839, -2.32286191, -2.33546257, -2.34485865, -2.35101223, -2.3538897, -2.3534615, -2.34970307,
+        -2.34259415, -2.33211827, -2.31826496, -2.30102706, -2.28040266, -2.25639415, -2.22900987, -2.19826174,
+        -2.16416669, -2.12674665, -2.08602858, -2.04204369, -1.9948287, -1.94442439, -1.89087701, -1.8342371,
+        -1.77455986, -1.71190572, -1.64633906, -1.57792938, -1.50675035, -1.43288004, -1.35640121, -1.27740085,
+        -1.19596994, -1.11220384, -1.02620149, -0.938066363, -0.847905338, -0.755828917, -0.661951303, -0.566390336,
+        -0.469267011, -0.370705426, -0.270832837, -0.169779301, -0.0676778704, 0.0353360027, 0.1391242, 0.243546396,
+        0.34845987, 0.453720033, 0.559180021, 0.664691627, 0.770104349, 0.875266314, 0.980023861, 1.08422208,
+        1.18770385, 1.29031074, 1.39188242, 1.4922564, 1.59126747, 1.68874717, 1.78452349, 1.8784188,
+        1.97024918, 2.05982161, 2.14693165, 2.23135877, 2.31286192, 2.39117241, 2.46598387, 2.53693914,
+        2.60361433, 2.6654954, 2.72194791, 2.77217722, 2.81517649, 2.84966278, 2.87399673, 2.88609076,
+        2.88330984, 2.86238742, 2.81938577, 2.74975944, 2.64860725, 2.51121068, 2.33392859, 2.15482497,
+        1.97570574, 1.79675126, 1.61814189, 1.44005704, 1.262676, 1.08617771, 0.910740674, 0.741189659,
+        0.581724703, 0.435531467, 0.304635614, 0.189938128, 0.0913835466, 0.00819712877, -0.06086725, -0.117307365,
+        -0.16270107, -0.198586285, -0.226386651, -0.247372761, -0.262648702, -0.273155153, -0.279681623, -0.282883435,
+        -0.28330034, -0.281373888, -0.277464569, -0.271865666, -0.264815956, -0.256510258, -0.247107655, -0.23673898,
+        -0.225512296, -0.213517904, -0.200831503, -0.187517896, -0.173632979, -0.159225613, -0.144339353, -0.129013568,
+        -0.11328426, -0.0971851945, -0.0807480514, -0.064003095, -0.0469798297, -0.0297065824, -0.0122113675, 0.00547802448,
+        0.0233342797, 0.0413301438, 0.0594382882, 0.077631548, 0.0958827734, 0.114164576, 0.132449776, 0.150710836,
+        0.168920428, 0.187051058, 0.205075547, 0.222966284, 0.24069576, 0.258236974, 0.275562525, 0.292645454,
+        0.309458762, 0.325975806, 0.342170238, 0.358015776, 0.3734864, 0.388556957, 0.403202116, 0.417397022,
+        0.431117713, 0.444340348, 0.4570418, 0.4691993, 0.480791003, 0.491795391, 0.502191842, 0.511960506,
+        0.521081865, 0.529537737, 0.537310541, 0.544383287, 0.550740242, 0.556366205, 0.561247528, 0.565370679,
+        0.568723917, 0.571295798, 0.573076427, 0.574056745, 0.574228704, 0.57358551, 0.572121501, 0.569831848,
+        0.566713214, 0.562762976, 0.55798018, 0.552364349, 0.545917094, 0.538640141, 0.530537367, 0.5216133,
+        0.511873543, 0.50132519, 0.489976257, 0.477835953, 0.464914918, 0.451224327, 0.436777294, 0.421587586,
+        0.405669957, 0.38904056, 0.371716529, 0.353716195, 0.33505857, 0.315764189, 0.295853972, 0.2753506,
+        0.254277349, 0.232658297, 0.210518509, 0.187884241, 0.164782196, 0.141240358, 0.117286965, 0.0929515958,
+        0.0682645738, 0.0432563908, 0.0179587752, -0.00759635121, -0.0333760157, -0.0593471155, -0.0854755789, -0.111727402,
+        -0.138067365, -0.164460659, -0.190871492, -0.217264265, -0.243602872, -0.269850701, -0.295971453, -0.32192868,
+        -0.347685486, -0.373205483, -0.398451746, -0.423387766, -0.447977245, -0.472183764, -0.495971501, -0.519304812,
+        -0.542148292, -0.564466774, -0.586226106, -0.607391953, -0.627930939, -0.64781028, -0.66699779, -0.685461879,
+        -0.703171849, -0.72009778, -0.736210644, -0.751482069, -0.765884876, -0.779392719, -0.791980505, -0.803623855,
+        -0.814300001, -0.823986888, -0.832663774, -0.840311289, -0.846911073, -0.852446318, -0.856901586, -0.860262632,
+        -0.862516642, -0.863652349, -0.863659739, -0.86253047, -0.860257626, -0.856835842, -0.852261245, -0.84653157,
+        -0.83964622, -0.831605911, -0.822413206, -0.812072217, -0.800588667, -0.787969947, -0.774224877, -0.759364069,
+        -0.743399739, -0.726345718, -0.708217382, -0.689031839, -0.668807566, -0.647564769, -0.625325263, -0.602112174,
+        -0.577950418, -0.55286622, -0.526887357, -0.500043035, -0.47236377, -0.443881661, -0.414629996, -0.384643435,
+        -0.353957862, -0.322610438, -0.29063952, -0.258084595, -0.22498627, -0.191386133, -0.157326847, -0.122851983 },
+    // lorenz~ default
+    {
+        0.0251519717, 0.0258931518, 0.0271991584, 0.029066598, 0.0315132104, 0.0345780253, 0.0383218229, 0.0428280719,
+        0.0482043587, 0.0545843318, 0.0621300451, 0.0710343719, 0.081523031, 0.0938554183, 0.10832268, 0.125240833,
+        0.144935086, 0.167709842, 0.193796203, 0.223266348, 0.255903214, 0.291017741, 0.327221185, 0.362197369,
+        0.392581224, 0.414123207, 0.422335118, 0.413661957, 0.386850744, 0.343800932, 0.289243937, 0.229297563,
+        0.169708207, 0.114663534, 0.0664764568, 0.0258864816, -0.00741958944, -0.0343296714, -0.0559647568, -0.0734703466,
+        -0.0879056975, -0.100195363, -0.111116827, -0.121306852, -0.131275877, -0.141424164, -0.1520558, -0.163388371,
+        -0.175557002, -0.188612267, -0.202511981, -0.217107564, -0.232127175, -0.247159392, -0.26164338, -0.27487421,
+        -0.286032557, -0.294247717, -0.298695594, -0.298722953, -0.293975055, -0.284492046, -0.270741701, -0.253570259,
+        -0.234080836, -0.213473082, -0.192886665, -0.173284039, -0.155388147, -0.13967216, -0.126386538, -0.115606226,
+        -0.107283346, -0.101295903, -0.0974877104, -0.0956983268, -0.0957834944, -0.0976277813, -0.101151131, -0.106310725,
+        -0.113099448, -0.121541314, -0.13168405, -0.143588245, -0.157311916, -0.172889039, -0.190300047, -0.209432557,
+        -0.230031177, -0.251638532, -0.273533434, -0.294681162, -0.313720554, -0.329020262, -0.338836968, -0.341584742,
+        -0.336178273, -0.322352886, -0.300832152, -0.273248553, -0.241825268, -0.208936095, -0.176701456, -0.146733031,
+        -0.120052651, -0.0971440375, -0.0780738145, -0.0626279712, -0.0504324548, -0.0410452187, -0.0340192318, -0.0289410148,
+        -0.0254509877, -0.023251364, -0.0221063159, -0.0218378045, -0.0223195255, -0.0234704819, -0.0252491236, -0.0276485588,
+        -0.0306930747, -0.0344359986, -0.0389588587, -0.0443717763, -0.050814826, -0.0584602468, -0.0675151125, -0.0782238394,
+        -0.0908697248, -0.105773866, -0.123288862, -0.143783167, -0.167609692, -0.195048913, -0.226213604, -0.260900408,
+        -0.298376679, -0.337109476, -0.374488145, -0.406671822, -0.42878899, -0.435738951, -0.423639446, -0.391464978,
+        -0.341936111, -0.28089422, -0.215391979, -0.151639014, -0.0938230455, -0.0439861789, -0.00252261758, 0.031184176,
+        0.0582426898, 0.0799134001, 0.097417362, 0.111844026, 0.12411759, 0.134994477, 0.145075604, 0.154823765,
+        0.164580718, 0.174581394, 0.184963882, 0.195774838, 0.206970736, 0.218416482, 0.22988306, 0.241047308,
+        0.251497716, 0.260749906, 0.268276244, 0.273550749, 0.276107579, 0.275606483, 0.271893144, 0.265040189,
+        0.255356938, 0.243362069, 0.229724318, 0.215183958, 0.200472862, 0.186248347, 0.173049897, 0.161280915,
+        0.15121159, 0.142996147, 0.136697695, 0.132314652, 0.129805282, 0.129107758, 0.130155325, 0.132886216,
+        0.137248948, 0.143203169, 0.150716707, 0.159758627, 0.170288458, 0.182241172, 0.195507765, 0.209911615,
+        0.225181252, 0.240922481, 0.256594151, 0.271495759, 0.284777015, 0.295481533, 0.302632391, 0.305358738,
+        0.303045958, 0.295474738, 0.282905668, 0.266074151, 0.246088669, 0.224258736, 0.20190309, 0.18018797,
+        0.160026342, 0.142043114, 0.126592919, 0.113809101, 0.10366448, 0.0960303321, 0.0907259509, 0.0875565484,
+        0.0863396302, 0.0869218335, 0.0891882628, 0.0930664167, 0.0985263437, 0.10557802, 0.11426641, 0.12466421,
+        0.136861488, 0.150950998, 0.167007208, 0.185056776, 0.205037579, 0.226744607, 0.249762803, 0.273391992,
+        0.29657802, 0.317877054, 0.335492462, 0.347428918, 0.351787984, 0.34717533, 0.333110183, 0.310271919,
+        0.280445665, 0.24615781, 0.210140422, 0.17483218, 0.142064974, 0.112970546, 0.0880511627, 0.0673311353,
+        0.0505216494, 0.0371618681, 0.0267234482, 0.0186795425, 0.0125451805, 0.0078969067, 0.00437868666, 0.00169944111,
+        -0.000373936637, -0.00202551181, -0.00339959492, -0.00460948376, -0.00574522419, -0.00688026473, -0.00807705056, -0.00939170737,
+        -0.010877992, -0.0125907278, -0.0145889018, -0.01693861, -0.0197160263, -0.0230105165, -0.0269280728, -0.0315951556,
+        -0.0371630453, -0.0438127704, -0.051760532, -0.0612635091, -0.0726255178, -0.0862016007, -0.102399722, -0.121676281,
+        -0.14451991, -0.171414092, -0.202764317, -0.238768578, -0.279205531, -0.323117793, -0.368396848, -0.411355644,
+        -0.446525246, -0.467088461, -0.466366619, -0.440271914, -0.389612228, -0.320515633, -0.242270142, -0.163966164,
+        -0.0920939445, -0.0299755819, 0.0215556808, 0.0631508604, 0.0961355567, 0.122009352, 0.142189249, 0.157903612,
+        0.170166045, 0.179786921, 0.187399611, 0.193489954, 0.19842422, 0.202473521, 0.205834344, 0.208645448,
+        0.21100156, 0.212964803, 0.214573652, 0.215850517, 0.216807947, 0.21745351, 0.217793897, 0.217838004,
+        0.217599258, 0.217097044, 0.216357574, 0.215413764, 0.214304879, 0.213075384, 0.21177344, 0.210449383,
+        0.209153801, 0.207935765, 0.206841186, 0.205911323, 0.205181524, 0.204680204, 0.204428181, 0.20443809,
+        0.204714164, 0.205252081, 0.206039071, 0.207054093, 0.208268195, 0.209645018, 0.211141586, 0.212709233,
+        0.214294747, 0.215841919, 0.217293262, 0.218592152, 0.219684958, 0.220523626, 0.221067905, 0.221287757,
+        0.221165136, 0.220695525, 0.219888598, 0.218768269, 0.217371821, 0.215748459, 0.213956997, 0.212063298,
+        0.210137129, 0.208249375, 0.206469044, 0.204860598, 0.203481957, 0.202382669, 0.201602623, 0.201171264,
+        0.201106936, 0.201416776, 0.202096656, 0.203131199, 0.204494074, 0.206148297, 0.208046675, 0.210132509,
+        0.212340459, 0.214597806, 0.2168262, 0.218943879, 0.220868379, 0.222519785, 0.223824412, 0.224718601,
+        0.225152597, 0.225093871, 0.224529848, 0.223469526, 0.221943855, 0.220004708, 0.217722446, 0.215182468,
+        0.212480858, 0.209719539, 0.207001522, 0.204426408, 0.202086553, 0.200064018, 0.198428363, 0.197235227,
+        0.196525589, 0.196325466, 0.196646079, 0.197484046, 0.198821649, 0.200627208, 0.202855229, 0.205446601,
+        0.208328947, 0.211417153, 0.214614302, 0.217813283, 0.220899269, 0.22375308, 0.226255611, 0.228293374,
+        0.229764566, 0.23058556, 0.230697155, 0.230069786, 0.22870715, 0.226647571, 0.223962829, 0.220754653,
+        0.217148736, 0.213287458, 0.209321722, 0.205403015, 0.201676175, 0.19827351, 0.195310578, 0.192883536,
+        0.191067979, 0.189918742, 0.189470559, 0.189739138, 0.190722108, 0.192399934, 0.194736332, 0.197678342,
+        0.20115602, 0.205081895, 0.209350422, 0.213837892, 0.218402937, 0.22288847, 0.227125123, 0.230936721,
+        0.234148011, 0.236594245, 0.238132283, 0.23865211, 0.238087296, 0.236423239, 0.233701423, 0.230019048,
+        0.225523517, 0.220402673, 0.214871645, 0.209158495, 0.203490049, 0.19807978, 0.193118498, 0.188768327,
+        0.185160041, 0.182392851, 0.180536166, 0.179632455, 0.17970039, 0.180737704, 0.182723343, 0.185618624,
+        0.18936719, 0.193893939, 0.199103013, 0.204875156, 0.211064965, 0.217498571, 0.223972946, 0.230257303,
+        0.236098081, 0.24122794, 0.245379552, 0.248303637, 0.249789938, 0.249688864, 0.247930571, 0.244537711,
+        0.239629418, 0.233414754, 0.226176187, 0.218245968, 0.209978566, 0.201724291, 0.193806842, 0.186507389,
+        0.180055797, 0.174628422, 0.170350865, 0.167304203, 0.165532619, 0.165051103, 0.165852353, 0.167911708 },
+    // chua~ driven
+    {
+        0.226931885, 0.252923727, 0.28466019, 0.322755516, 0.363255888, 0.4027192, 0.44125098, 0.478794575,
+        0.515163124, 0.550069094, 0.583151221, 0.613999486, 0.642178357, 0.667248726, 0.68878752, 0.706406534,
+        0.719768882, 0.728603601, 0.732718766, 0.732011199, 0.726475179, 0.716207504, 0.701410115, 0.682390809,
+        0.659560382, 0.633427024, 0.604588747, 0.57372272, 0.541572511, 0.508933425, 0.476635873, 0.445527434,
+        0.416453719, 0.387674749, 0.355744421, 0.321643233, 0.286340207, 0.250775337, 0.215843827, 0.182382643,
+        0.151158974, 0.12286102, 0.0980914086, 0.077362515, 0.0610946193, 0.0496158302, 0.0431644842, 0.0418933779,
+        0.0458757877, 0.0551132634, 0.0695446506, 0.0890565887, 0.113494612, 0.142675459, 0.176399603, 0.214464337,
+        0.256677032, 0.302868426, 0.352905631, 0.40670532, 0.464246273, 0.525581598, 0.582754672, 0.631354511,
+        0.672390282, 0.706620336, 0.734614849, 0.756808102, 0.773541689, 0.785099983, 0.791739285, 0.793711066,
+        0.791280627, 0.784740925, 0.774422288, 0.760699213, 0.743993044, 0.724772215, 0.703549385, 0.680876434,
+        0.657337368, 0.633539081, 0.610100746, 0.587642431, 0.566772163, 0.548072934, 0.531678617, 0.515377939,
+        0.499503136, 0.4849419, 0.472566962, 0.463228136, 0.457746089, 0.456908345, 0.461467505, 0.472141504,
+        0.489616334, 0.514550745, 0.547583342, 0.587385952, 0.627529621, 0.667540967, 0.707075238, 0.745670736,
+        0.782778144, 0.81778872, 0.85006088, 0.878945947, 0.903812289, 0.924068451, 0.939184189, 0.948709786,
+        0.952293277, 0.949694812, 0.940798879, 0.925622463, 0.904321432, 0.877192199, 0.844670594, 0.807327092,
+        0.765858769, 0.721077561, 0.673895538, 0.625307441, 0.576370239, 0.528180838, 0.478567421, 0.421554178,
+        0.358022094, 0.288839877, 0.214837417, 0.136780381, 0.0553465486, -0.0288962126, -0.115510061, -0.192602366,
+        -0.254399776, -0.30268839, -0.338918358, -0.364296854, -0.379862368, -0.386544347, -0.385210276, -0.376701057,
+        -0.361857772, -0.341539741, -0.31663543, -0.2880674, -0.256791741, -0.223792836, -0.190074027, -0.156645611,
+        -0.124509647, -0.0919972509, -0.0551503897, -0.0149267912, 0.0277224332, 0.0718720034, 0.116641551, 0.161211729,
+        0.204839066, 0.246867985, 0.286741257, 0.324007571, 0.358327031, 0.389474839, 0.417342335, 0.441577584,
+        0.458005458, 0.466986626, 0.46999383, 0.468298525, 0.463009775, 0.455103189, 0.445443213, 0.43479827,
+        0.423851877, 0.41320926, 0.403401554, 0.394887686, 0.388054788, 0.383217782, 0.380618453, 0.380424142,
+        0.3827281, 0.387548089, 0.394828796, 0.404442787, 0.416193604, 0.429820627, 0.445004255, 0.461372763,
+        0.47851029, 0.495966196, 0.513264954, 0.529916883, 0.545429766, 0.55932045, 0.571126819, 0.580419421,
+        0.586812675, 0.589975536, 0.589641333, 0.585615695, 0.577783823, 0.566115737, 0.550670028, 0.531595111,
+        0.50912863, 0.483595341, 0.455402046, 0.425030828, 0.393030345, 0.36000514, 0.326603621, 0.293504179,
+        0.261400491, 0.230985641, 0.200413525, 0.167250574, 0.132289976, 0.0963153318, 0.0600861236, 0.0243255198,
+        -0.0102908984, -0.0431452133, -0.0736840889, -0.101424567, -0.125958011, -0.146951869, -0.164149985, -0.177370682,
+        -0.186503693, -0.191505671, -0.192393869, -0.189239368, -0.182158858, -0.171305805, -0.156861186, -0.139023513,
+        -0.117998995, -0.0939910114, -0.0671899915, -0.0377639383, -0.00584809482, 0.0284643322, 0.0651310533, 0.104169205,
+        0.145663887, 0.18389532, 0.21548973, 0.241344094, 0.262149781, 0.278441519, 0.290637136, 0.299070865,
+        0.304019898, 0.305726886, 0.304416925, 0.300312221, 0.293641865, 0.284650028, 0.273600996, 0.260782093,
+        0.246504262, 0.231100947, 0.21492596, 0.19834879, 0.181749701, 0.165513352, 0.150022224, 0.135648534,
+        0.122747064, 0.111646593, 0.102643028, 0.0959914029, 0.0918993503, 0.0905214697, 0.091953814, 0.0962302834,
+        0.103320137, 0.113126785, 0.125487819, 0.140177011, 0.156907588, 0.175337031, 0.195073217, 0.215682209,
+        0.23669678, 0.257626593, 0.277968556, 0.297218442, 0.314882606, 0.330489576, 0.343602061, 0.353828073,
+        0.360831857, 0.364342928, 0.364165068, 0.36018306, 0.352368087, 0.340781033, 0.32557416, 0.306990385,
+        0.285360575, 0.261098772, 0.234695137, 0.206706882, 0.177747726, 0.14847523, 0.119576856, 0.0917550027,
+        0.0657111406, 0.042050153, 0.0174717754, -0.00840306282, -0.0346714705, -0.0604440719, -0.0848574489, -0.10708493,
+        -0.126345396, -0.141909614, -0.15310511, -0.159318104, -0.159993678, -0.154633731, -0.142792463, -0.124070324,
+        -0.0981055796, -0.0645646304, -0.0231297165, 0.026513651, 0.0846919119, 0.147107959, 0.204855695, 0.258191407,
+        0.307154089, 0.35162124, 0.39135778, 0.426059842, 0.455392122, 0.479022741, 0.496651947, 0.508038044,
+        0.513019264, 0.511531055, 0.503620088, 0.489454687, 0.469330013, 0.44367075, 0.413028687, 0.378077686,
+        0.339604259, 0.298494518, 0.255719304, 0.212314367, 0.169360206, 0.1279594, 0.0837879479, 0.0335242301,
+        -0.0218414366, -0.0813346431, -0.144021928, -0.209034383, -0.27558893, -0.343006879, -0.410732329, -0.476527929,
+        -0.528881013, -0.567506135, -0.594109237, -0.610125721, -0.616794765, -0.615219474, -0.606411695, -0.591328025,
+        -0.570895255, -0.546026826, -0.517634451, -0.486632615, -0.453937769, -0.420464814, -0.387118518, -0.354743838,
+        -0.319431305, -0.280418277, -0.238481611, -0.194387034, -0.14887172, -0.10262917, -0.0562952496, -0.0104363617,
+        0.0344617292, 0.0780015662, 0.119881719, 0.15990065, 0.197961524, 0.234072015, 0.268346488, 0.301003605,
+        0.328975946, 0.35066396, 0.367423058, 0.380385578, 0.390501648, 0.398569226, 0.405260473, 0.411138952,
+        0.416674882, 0.422256649, 0.428199053, 0.434750021, 0.442095608, 0.450365007, 0.459633321, 0.469926119,
+        0.481221974, 0.493455887, 0.50652343, 0.52028501, 0.534569561, 0.54918021, 0.563898802, 0.578492284,
+        0.592718542, 0.606331468, 0.619088531, 0.630756259, 0.641116977, 0.649973989, 0.657157838, 0.662530541,
+        0.665991068, 0.667477667, 0.666971982, 0.66449976, 0.660132766, 0.653988302, 0.646227479, 0.63705337,
+        0.626707911, 0.615466595, 0.603634477, 0.591538906, 0.579522729, 0.567937672, 0.557135165, 0.547459066,
+        0.539237142, 0.532773077, 0.528337598, 0.526162863, 0.526434243, 0.529285014, 0.534791589, 0.542970181,
+        0.553773701, 0.567091644, 0.582749903, 0.600513399, 0.620088875, 0.641130447, 0.663245499, 0.686002791,
+        0.708940566, 0.731577158, 0.753420889, 0.773981273, 0.792781115, 0.809366941, 0.823321521, 0.834273696,
+        0.841909409, 0.845979929, 0.846310973, 0.842807651, 0.835460722, 0.82434845, 0.809638321, 0.791585565,
+        0.770530224, 0.746892035, 0.721162975, 0.693898499, 0.665706277, 0.637233853, 0.60915494, 0.582154453,
+        0.55691278, 0.534089983, 0.510504305, 0.485726625, 0.46065563, 0.436174273, 0.413137585, 0.392362505,
+        0.374619752, 0.36062777, 0.351048708, 0.346486866, 0.347489119, 0.354547679, 0.368104815, 0.388559699,
+        0.416277111, 0.45159778, 0.494850874, 0.546367407, 0.603512228, 0.656753302, 0.705974936, 0.75116694 },
+    // thomas~ rk4
+    {
+        0.00958921295, 0.00927857682, 0.00913699996, 0.00922210794, 0.00958293676, 0.0102627473, 0.0113018742, 0.0127405105,
+        0.0146213723, 0.0169921424, 0.0199076533, 0.0234316271, 0.0276377983, 0.0326100402, 0.0384410322, 0.0452286266,
+        0.0530690253, 0.0620456412, 0.0722128451, 0.0835748762, 0.0960622951, 0.109511577, 0.123656407, 0.138139114,
+        0.152546033, 0.166460469, 0.179518133, 0.191448569, 0.202092677, 0.211396888, 0.219392329, 0.22616826,
+        0.231847286, 0.236565739, 0.240459904, 0.243657812, 0.24627474, 0.248411536, 0.250154585, 0.251576692,
+        0.252738446, 0.253689885, 0.254471838, 0.255117387, 0.255653232, 0.256100655, 0.256476432, 0.256793708,
+        0.257062614, 0.25729084, 0.257484138, 0.25764659, 0.257781088, 0.257889539, 0.257973135, 0.258032531,
+        0.258068144, 0.258080095, 0.258068562, 0.258033842, 0.257976383, 0.25789696, 0.257796735, 0.257677317,
+        0.257540792, 0.257389665, 0.257227123, 0.257056683, 0.256882489, 0.25670895, 0.256540984, 0.256383717,
+        0.256242424, 0.25612244, 0.25602904, 0.2559672, 0.25594154, 0.255956173, 0.256014466, 0.256118953,
+        0.256271124, 0.256471395, 0.256718934, 0.257011503, 0.257345617, 0.257716268, 0.25811705, 0.258540243,
+        0.258976847, 0.25941664, 0.259848446, 0.260260195, 0.260639369, 0.260973006, 0.261248171, 0.261452168,
+        0.261573046, 0.26159972, 0.261522561, 0.261333704, 0.261027426, 0.260600537, 0.260052562, 0.259386331,
+        0.258607984, 0.257727325, 0.256757796, 0.255716622, 0.254624665, 0.253506243, 0.252388746, 0.251302332,
+        0.250279129, 0.249352723, 0.24855721, 0.247926235, 0.247492, 0.247284129, 0.24732852, 0.247646257,
+        0.248252615, 0.249156028, 0.250357479, 0.25184989, 0.253617853, 0.255637556, 0.257877201, 0.260297328,
+        0.262851447, 0.265486926, 0.26814568, 0.270765185, 0.273279041, 0.275617808, 0.277710021, 0.279482722,
+        0.280863017, 0.281779259, 0.282163084, 0.281951576, 0.281089991, 0.2795344, 0.277254343, 0.274235517,
+        0.270481616, 0.266015977, 0.260882765, 0.255147517, 0.248897552, 0.242242083, 0.235311776, 0.228258088,
+        0.221251607, 0.214479595, 0.208142117, 0.202446923, 0.197602659, 0.19381085, 0.191256315, 0.190096721,
+        0.190451607, 0.19239144, 0.195927888, 0.201006413, 0.207502753, 0.215225026, 0.223922893, 0.233304247,
+        0.243058681, 0.252885282, 0.262520283, 0.271760732, 0.280479848, 0.288631499, 0.296243727, 0.303402156,
+        0.310225844, 0.316838652, 0.323339105, 0.329772443, 0.336108536, 0.342231095, 0.347942084, 0.352985382,
+        0.35708788, 0.360010386, 0.361596316, 0.361804545, 0.360718817, 0.358533442, 0.355522305, 0.352001756,
+        0.348295212, 0.344705462, 0.341495961, 0.338880897, 0.337021977, 0.336030215, 0.335970134, 0.336865157,
+        0.338702053, 0.341433823, 0.344979376, 0.349220365, 0.35399434, 0.359085321, 0.364213914, 0.369029343,
+        0.373108715, 0.375967532, 0.377085805, 0.375949383, 0.372102529, 0.365202039, 0.35506174, 0.341678143,
+        0.325232863, 0.306075394, 0.284692138, 0.261667907, 0.23764208, 0.21326302, 0.189151719, 0.165889204,
+        0.14403002, 0.124122612, 0.10670834, 0.0922876894, 0.0812674314, 0.0739130825, 0.0703234449, 0.0704292506,
+        0.0740085393, 0.0807096288, 0.0900756493, 0.101569928, 0.114605263, 0.128581092, 0.142928272, 0.157154948,
+        0.170882136, 0.18385978, 0.195960626, 0.207157165, 0.217490554, 0.227039978, 0.235897377, 0.244149551,
+        0.251867324, 0.25910005, 0.265873879, 0.272192091, 0.278036535, 0.283369243, 0.288134068, 0.29225862,
+        0.29565686, 0.298232555, 0.299884647, 0.300513595, 0.300029099, 0.298357636, 0.295448869, 0.291280001,
+        0.285857677, 0.279217452, 0.271421671, 0.262557149, 0.252733499, 0.242082909, 0.230761439, 0.218950823,
+        0.206859827, 0.194723889, 0.182801962, 0.171370566, 0.160715297, 0.15112035, 0.142857119, 0.136172339,
+        0.131277278, 0.128338322, 0.127469942, 0.128729656, 0.132114276, 0.137556165, 0.144918546, 0.15399009,
+        0.16448018, 0.17601867, 0.188164353, 0.200425267, 0.212291226, 0.223274186, 0.232949376, 0.240988493,
+        0.247178987, 0.251426876, 0.253744453, 0.25422734, 0.253026217, 0.250318706, 0.24628444, 0.241086349,
+        0.23485744, 0.227693602, 0.219651133, 0.210748196, 0.200969771, 0.190275565, 0.178610831, 0.165919781,
+        0.152160913, 0.137322783, 0.121438257, 0.104594246, 0.0869348571, 0.0686567724, 0.0499977581, 0.0312212855,
+        0.0126021607, -0.0055801319, -0.0230323952, -0.0394173935, -0.0543067642, -0.0671407282, -0.0772358775, -0.0838769749,
+        -0.0864855424, -0.0847974941, -0.0789573789, -0.069479309, -0.0571022294, -0.0426159799, -0.0267271344, -0.0099914968,
+        0.00719606131, 0.0245776121, 0.0419930108, 0.0593359768, 0.0765105709, 0.0933928564, 0.109804966, 0.12550953,
+        0.140228853, 0.153684363, 0.165643215, 0.175956264, 0.184576735, 0.191558421, 0.197039247, 0.201217994,
+        0.20433107, 0.206632689, 0.208379656, 0.209820077, 0.211185485, 0.212684542, 0.21449843, 0.216776609,
+        0.219633564, 0.223146006, 0.227351457, 0.232248232, 0.237797618, 0.243928179, 0.250542253, 0.257524461,
+        0.26475057, 0.272096366, 0.279444367, 0.286687493, 0.293728739, 0.30047673, 0.306837976, 0.312707752,
+        0.317961872, 0.322452784, 0.326012194, 0.328461587, 0.329629749, 0.329373479, 0.327596158, 0.324259549,
+        0.319385022, 0.313044935, 0.30534631, 0.296412021, 0.286363512, 0.275308579, 0.26333639, 0.250519603,
+        0.236923769, 0.222620711, 0.207703695, 0.192300007, 0.176577225, 0.160740957, 0.145024702, 0.129673883,
+        0.114927985, 0.101003103, 0.0880769342, 0.0762770101, 0.0656730309, 0.0562740564, 0.0480307452, 0.0408421382,
+        0.0345656648, 0.0290286932, 0.0240401458, 0.0194010176, 0.0149133569, 0.0103876088, 0.00564875966, 0.000541789457,
+        -0.00506296707, -0.0112640839, -0.0181227084, -0.0256557707, -0.0338293165, -0.0425529629, -0.0516762994, -0.0609875284,
+        -0.0702132657, -0.0790172517, -0.0869961232, -0.0936734527, -0.0984992608, -0.10086783, -0.100167945, -0.0958717689,
+        -0.0876521394, -0.075497888, -0.0597850457, -0.0412685573, -0.0209861696, -9.92327914e-05, 0.02028591, 0.0392749868,
+        0.0562928617, 0.071125038, 0.083892338, 0.0949741527, 0.10490638, 0.114278279, 0.123642527, 0.133443117,
+        0.143962711, 0.155292749, 0.167332038, 0.179816738, 0.192377076, 0.204606414, 0.216124132, 0.226618081,
+        0.23586233, 0.243714675, 0.250102609, 0.255005926, 0.258441061, 0.26044938, 0.261089891, 0.260435104,
+        0.258569658, 0.25559032, 0.251606792, 0.246742874, 0.241137624, 0.2349464, 0.228341386, 0.221511468,
+        0.214661032, 0.208007649, 0.201778248, 0.196203738, 0.191512004, 0.187919483, 0.185621351, 0.184780687,
+        0.185517222, 0.187896237, 0.191918716, 0.197514117, 0.204537272, 0.21277149, 0.22193943, 0.231722042,
+        0.241784886, 0.251808316, 0.261517465, 0.270706952, 0.279256165, 0.287133127, 0.294386744, 0.301129133,
+        0.307510972, 0.313692957, 0.319815904, 0.325972527, 0.332183391, 0.338381231, 0.344407469, 0.350025922,
+        0.354954839, 0.358914137, 0.361678243, 0.363121301, 0.363242626, 0.362167358, 0.360124916, 0.357414305 },
+    // aizawa~ euler
+    {
+        0.0661448166, 0.065529801, 0.0648239106, 0.0640294999, 0.0631489977, 0.0621849075, 0.0611397773, 0.0600162372,
+        0.058816947, 0.05754463, 0.0562020503, 0.054792013, 0.0533173606, 0.0517809615, 0.0501857102, 0.0485345423,
+        0.0468304008, 0.0450762436, 0.0432750396, 0.041429773, 0.039543435, 0.0376190096, 0.0356594846, 0.0336678438,
+        0.0316470563, 0.0296000913, 0.0275298934, 0.0254393946, 0.0233315043, 0.0212091133, 0.0190750863, 0.0169322602,
+        0.0147834383, 0.0126313996, 0.0104788821, 0.00832859054, 0.00618319213, 0.00404531322, 0.00191753765, -0.000197591886,
+        -0.00229757931, -0.00437997328, -0.00644237082, -0.00848241709, -0.0104978066, -0.0124862855, -0.0144456513, -0.0163737535,
+        -0.0182684958, -0.0201278366, -0.0219497867, -0.0237324126, -0.0254738368, -0.0271722358, -0.0288258474, -0.0304329619,
+        -0.0319919288, -0.0335011445, -0.0349590778, -0.0363642424, -0.037715219, -0.0390106291, -0.0402491689, -0.041429583,
+        -0.0425506681, -0.0436112843, -0.0446103439, -0.0455468111, -0.0464197099, -0.047228124, -0.0479711816, -0.0486480668,
+        -0.0492580235, -0.0498003513, -0.0502743982, -0.0506795608, -0.0510152988, -0.0512811169, -0.0514765754, -0.051601287,
+        -0.0516549163, -0.0516371801, -0.0515478477, -0.0513867363, -0.0511537157, -0.050848715, -0.0504717045, -0.0500227176,
+        -0.0495018326, -0.0489091799, -0.0482449457, -0.0475093685, -0.0467027389, -0.0458254069, -0.044877775, -0.0438602939,
+        -0.0427734815, -0.0416179076, -0.0403941944, -0.0391030312, -0.0377451628, -0.0363213941, -0.0348325931, -0.0332796872,
+        -0.0316636674, -0.0299855955, -0.0282465946, -0.0264478587, -0.0245906468, -0.0226762891, -0.0207061917, -0.0186818279,
+        -0.0166047476, -0.014476575, -0.012299018, -0.0100738546, -0.00780294836, -0.00548824249, -0.00313176261, -0.000735619455,
+        0.00169799186, 0.00416678935, 0.00666840374, 0.00920037739, 0.0117601603, 0.0143451188, 0.0169525221, 0.0195795484,
+        0.0222232901, 0.0248807408, 0.027548803, 0.0302242897, 0.0329039209, 0.0355843231, 0.038262032, 0.040933501,
+        0.0435950831, 0.0462430492, 0.048873581, 0.0514827818, 0.0540666729, 0.0566211902, 0.0591421872, 0.061625462,
+        0.064066723, 0.0664616227, 0.0688057318, 0.0710945874, 0.0733236521, 0.0754883513, 0.0775840431, 0.0796060711,
+        0.081549719, 0.0834102631, 0.0851829574, 0.0868630111, 0.088445656, 0.0899261087, 0.091299586, 0.0925613344,
+        0.0937066078, 0.0947306976, 0.0956289321, 0.0963966772, 0.097029373, 0.0975224972, 0.0978716537, 0.0980724841,
+        0.0981207415, 0.0980122909, 0.0977431163, 0.0973093137, 0.0967071354, 0.0959329754, 0.094983384, 0.093855083,
+        0.0925450027, 0.09105023, 0.0893680751, 0.0874960721, 0.0854319856, 0.0831737965, 0.080719769, 0.0780684054,
+        0.0752184913, 0.0721691102, 0.068919614, 0.0654696971, 0.0618193373, 0.0579688661, 0.0539189428, 0.049670577,
+        0.045225136, 0.0405843407, 0.0357503109, 0.0307255313, 0.025512889, 0.0201156661, 0.0145375524, 0.00878264755,
+        0.00285547413, -0.00323902396, -0.00949547347, -0.015908068, -0.0224705637, -0.0291762799, -0.0360180922, -0.0429884307,
+        -0.0500792861, -0.0572822094, -0.0645883083, -0.0719882399, -0.0794722363, -0.0870300829, -0.0946511552, -0.102324381,
+        -0.11003828, -0.117780976, -0.125540167, -0.13330318, -0.141056925, -0.14878799, -0.156482548, -0.164126486,
+        -0.171705306, -0.179204255, -0.186608195, -0.193901807, -0.201069444, -0.208095223, -0.214963064, -0.22165671,
+        -0.228159651, -0.234455317, -0.240526959, -0.246357769, -0.251930833, -0.257229209, -0.262235999, -0.266934216,
+        -0.271307021, -0.275337636, -0.279009432, -0.282305866, -0.285210639, -0.287707686, -0.289781153, -0.291415572,
+        -0.292595774, -0.293306947, -0.293534696, -0.293265164, -0.292484939, -0.291181147, -0.28934148, -0.286954284,
+        -0.284008592, -0.280494064, -0.276401162, -0.271721125, -0.266445994, -0.260568708, -0.254083037, -0.246983796,
+        -0.239266694, -0.23092851, -0.221967027, -0.212381154, -0.202170908, -0.191337466, -0.179883212, -0.167811722,
+        -0.155127838, -0.141837701, -0.127948731, -0.113469683, -0.0984106958, -0.0827832744, -0.0666003153, -0.049876146,
+        -0.0326265134, -0.0148686226, 0.00337887439, 0.0220958591, 0.0412607491, 0.0608504936, 0.0808405802, 0.101205043,
+        0.121916465, 0.142946005, 0.164263412, 0.18583706, 0.207633913, 0.229619712, 0.251758784, 0.274014324,
+        0.296348274, 0.318721414, 0.34109351, 0.363423228, 0.385668337, 0.407785624, 0.42973119, 0.451460242,
+        0.472927511, 0.49408704, 0.514892399, 0.535296798, 0.555253088, 0.574714065, 0.593632221, 0.611960173,
+        0.629650593, 0.646656275, 0.662930489, 0.678426743, 0.693099141, 0.706902266, 0.719791591, 0.731723249,
+        0.742654443, 0.752543211, 0.761349082, 0.769032419, 0.775555372, 0.780881345, 0.78497541, 0.787804365,
+        0.789337039, 0.789543986, 0.788398147, 0.785874546, 0.781950712, 0.776606679, 0.769825101, 0.761591613,
+        0.751894653, 0.740725875, 0.728079975, 0.713955283, 0.69835341, 0.6812796, 0.662742972, 0.642756283,
+        0.621336222, 0.59850359, 0.574283004, 0.548703194, 0.52179718, 0.493601859, 0.464158237, 0.433511436,
+        0.401710451, 0.36880824, 0.334861577, 0.299930811, 0.264079958, 0.227376312, 0.189890444, 0.151695922,
+        0.112869106, 0.073488988, 0.0336369164, -0.00660361862, -0.0471472442, -0.0879069492, -0.128794342, -0.16971992,
+        -0.210593343, -0.2513237, -0.291819751, -0.331990242, -0.371744275, -0.410991371, -0.449641883, -0.48760733,
+        -0.524800658, -0.561136305, -0.596530855, -0.630903006, -0.66417402, -0.696267962, -0.727111816, -0.756636083,
+        -0.784774542, -0.811465144, -0.836649418, -0.8602736, -0.882287979, -0.902647674, -0.921312511, -0.938247144,
+        -0.953421235, -0.96680963, -0.978392243, -0.988154173, -0.996085763, -1.00218236, -1.00644445, -1.00887775,
+        -1.00949287, -1.00830507, -1.00533438, -1.00060558, -0.994147718, -0.985993981, -0.976181507, -0.964751482,
+        -0.95174855, -0.937220752, -0.921219289, -0.903798282, -0.885014534, -0.864927471, -0.843598545, -0.821091413,
+        -0.797471464, -0.772805631, -0.747162223, -0.720610559, -0.693221033, -0.665064633, -0.636212885, -0.606737554,
+        -0.576710463, -0.546203375, -0.515287757, -0.484034508, -0.452513903, -0.420795381, -0.388947368, -0.357037157,
+        -0.325130641, -0.293292373, -0.261585236, -0.230070397, -0.19880724, -0.167853177, -0.137263596, -0.107091717,
+        -0.0773886144, -0.0482030325, -0.0195814054, 0.00843223743, 0.0357962959, 0.0624716505, 0.0884216651, 0.113612227,
+        0.138011739, 0.161591142, 0.184323877, 0.206185907, 0.227155685, 0.247214168, 0.266344666, 0.284532994,
+        0.30176723, 0.318037868, 0.333337605, 0.347661376, 0.361006349, 0.373371691, 0.384758651, 0.39517051,
+        0.404612392, 0.413091362, 0.42061615, 0.427197307, 0.432846904, 0.437578648, 0.441407681, 0.44435057,
+        0.4464252, 0.447650671, 0.44804734, 0.447636545, 0.446440667, 0.444483101, 0.441788018, 0.438380361,
+        0.43428582, 0.42953068, 0.424141735, 0.418146372, 0.411572307, 0.404447556, 0.396800488, 0.388659596,
+        0.38005358, 0.371011138, 0.36156106, 0.351731986, 0.341552556, 0.331051141, 0.320255995, 0.309195071,
+        0.297895998, 0.286386073, 0.274692178, 0.262840748, 0.25085783, 0.238768801, 0.226598606, 0.214371592,
+        0.202111483, 0.189841375, 0.177583694, 0.165360212, 0.153191984, 0.141099334, 0.129101858, 0.11721842 },
+    // gendy~ default
+    {
+        0, -0.0535861365, -0.107172273, -0.160758406, -0.214344546, -0.267930686, -0.321516812, -0.375102967,
+        -0.428689092, -0.43773821, -0.382716119, -0.327694029, -0.272671938, -0.217649847, -0.162627742, -0.107605651,
+        -0.0525835603, 0.00243853382, 0.0574606284, 0.112482719, 0.167504817, 0.223811999, 0.272154421, 0.320496827,
+        0.368839234, 0.417181671, 0.465524077, 0.513866484, 0.562208891, 0.610551357, 0.658893764, 0.707236171,
+        0.755578578, 0.803920984, 0.852263391, 0.900605857, 0.884716749, 0.768853426, 0.652990103, 0.53712678,
+        0.421263397, 0.305400074, 0.189536721, 0.0736733824, -0.0421899557, -0.158053294, -0.241134509, -0.228227273,
+        -0.215320036, -0.202412799, -0.189505562, -0.176598325, -0.163691089, -0.150783837, -0.1378766, -0.124969363,
+        -0.112062126, -0.0851704925, -0.00098432519, 0.083201848, 0.167388022, 0.251574188, 0.335760355, 0.419946522,
+        0.504132688, 0.588318884, 0.672505021, 0.756691217, 0.840877354, 0.92506355, 0.967514455, 0.934416354,
+        0.901318312, 0.86822021, 0.835122108, 0.802024007, 0.768925905, 0.735827863, 0.702729762, 0.66963166,
+        0.636533558, 0.603435457, 0.570337415, 0.537239313, 0.504141212, 0.472380966, 0.507337987, 0.542295039,
+        0.57725203, 0.612209082, 0.647166133, 0.682123125, 0.717080176, 0.752037227, 0.786994219, 0.82195127,
+        0.856908262, 0.891865313, 0.926822364, 0.934352875, 0.935856164, 0.937359452, 0.938862741, 0.94036603,
+        0.941869378, 0.943372667, 0.944875956, 0.946379244, 0.90043658, 0.84329778, 0.786159039, 0.729020238,
+        0.671881437, 0.614742696, 0.557603896, 0.500465095, 0.443326354, 0.386187553, 0.329048783, 0.271910012,
+        0.214771226, 0.15763244, 0.161337465, 0.225192651, 0.289047837, 0.352903008, 0.416758209, 0.48061341,
+        0.544468582, 0.608323753, 0.672178984, 0.736034155, 0.799889326, 0.863744497, 0.927599728, 0.898733437,
+        0.858110964, 0.817488492, 0.776866019, 0.736243546, 0.695621073, 0.654998541, 0.614376068, 0.573753595,
+        0.533131123, 0.49250868, 0.451886207, 0.411263734, 0.356772304, 0.280340701, 0.203909054, 0.127477437,
+        0.0510458015, -0.0253858268, -0.101817459, -0.178249091, -0.254680723, -0.299998552, -0.264186889, -0.228375211,
+        -0.192563534, -0.156751856, -0.120940179, -0.0851285011, -0.0493168235, -0.0135051468, 0.0270566922, 0.0839248449,
+        0.140792996, 0.197661147, 0.254529297, 0.311397433, 0.368265599, 0.425133735, 0.482001901, 0.538870037,
+        0.595738173, 0.652606368, 0.709474504, 0.751552165, 0.677642822, 0.60373354, 0.529824197, 0.455914885,
+        0.382005572, 0.30809626, 0.234186962, 0.16027765, 0.0863683373, 0.0124590285, -0.061450284, -0.1353596,
+        -0.209268898, -0.234504402, -0.253560156, -0.27261591, -0.291671664, -0.310727417, -0.329783171, -0.348838925,
+        -0.367894679, -0.386950433, -0.406006187, -0.3653301, -0.292457104, -0.219584107, -0.146711096, -0.0738380998,
+        -0.000965097861, 0.0719079077, 0.144780904, 0.217653915, 0.290526897, 0.363399923, 0.436272919, 0.509145916,
+        0.582018912, 0.65445894, 0.638573706, 0.622688532, 0.606803358, 0.590918124, 0.575032949, 0.559147775,
+        0.543262601, 0.527377367, 0.511492193, 0.495606989, 0.479721814, 0.46383661, 0.447951436, 0.432066232,
+        0.417642415, 0.455899239, 0.494156063, 0.532412887, 0.570669711, 0.608926535, 0.647183359, 0.685440123,
+        0.723696947, 0.761953771, 0.800210595, 0.838467419, 0.876724243, 0.914981067, 0.953237891, 0.954528987,
+        0.927354813, 0.900180638, 0.873006463, 0.845832288, 0.818658173, 0.791483998, 0.764309824, 0.737135649,
+        0.709961474, 0.653236091, 0.60096401, 0.548691869, 0.496419728, 0.444147587, 0.391875476, 0.339603335,
+        0.287331223, 0.235059083, 0.182786956, 0.13051483, 0.154494688, 0.191487387, 0.228480086, 0.26547277,
+        0.302465469, 0.339458168, 0.376450866, 0.413443565, 0.450436264, 0.487428933, 0.524421632, 0.561414361,
+        0.59840703, 0.635399699, 0.672392428, 0.709385097, 0.694935679, 0.671475291, 0.648014903, 0.624554515,
+        0.601094127, 0.577633739, 0.55417335, 0.530712962, 0.507252514, 0.483792156, 0.460331768, 0.43687135,
+        0.413410962, 0.389950573, 0.367372513, 0.338949382, 0.310526282, 0.282103151, 0.253680021, 0.225256905,
+        0.196833774, 0.168410659, 0.139987543, 0.111564413, 0.0831412897, 0.0451344363, -0.00877966546, -0.0626937672,
+        -0.116607875, -0.170521975, -0.224436074, -0.278350174, -0.332264274, -0.386178374, -0.247726098, -0.175196111,
+        -0.10266614, -0.0301361606, 0.0423938185, 0.114923798, 0.187453777, 0.259983748, 0.33251372, 0.405043721,
+        0.477573693, 0.550103664, 0.622633636, 0.695163608, 0.767693579, 0.767728746, 0.723973691, 0.680218637,
+        0.636463583, 0.592708468, 0.548953414, 0.505198359, 0.461443335, 0.41768828, 0.373933196, 0.330178142,
+        0.286423087, 0.242668033, 0.198912978, 0.155157924, 0.111402862, 0.066713661, -0.0157014392, -0.0981165394,
+        -0.180531636, -0.262946725, -0.345361829, -0.427776933, -0.510192037, -0.592607141, -0.639200628, -0.581082106,
+        -0.522963583, -0.464845061, -0.406726539, -0.348608017, -0.290489495, -0.232370958, -0.174252436, -0.116133913,
+        -0.0580153838, 0.000103142534, 0.058221668, 0.116340198, 0.174458727, 0.232577249, 0.268664539, 0.287540704,
+        0.306416869, 0.325293034, 0.344169229, 0.363045394, 0.38192156, 0.400797755, 0.41967392, 0.438550085,
+        0.45742628, 0.476302445, 0.49517861, 0.514054775, 0.52942431, 0.534836054, 0.540247798, 0.545659542,
+        0.551071286, 0.55648303, 0.561894774, 0.567306519, 0.572718263, 0.578130007, 0.583541691, 0.588953435,
+        0.59436518, 0.599776924, 0.605188668, 0.610600412, 0.616012156, 0.631906509, 0.664095283, 0.696283996,
+        0.728472769, 0.760661542, 0.792850316, 0.825039089, 0.857227802, 0.889416575, 0.843196511, 0.769004941,
+        0.694813311, 0.620621741, 0.546430111, 0.472238511, 0.398046911, 0.323855311, 0.249663696, 0.242480844,
+        0.294926047, 0.34737125, 0.399816424, 0.452261627, 0.50470686, 0.557152033, 0.609597206, 0.662042439,
+        0.714487612, 0.766932845, 0.819378018, 0.871823192, 0.924268425, 0.900242984, 0.865466654, 0.830690384,
+        0.795914054, 0.761137784, 0.726361454, 0.691585183, 0.656808853, 0.622032583, 0.587256253, 0.552479982,
+        0.517703652, 0.482927352, 0.448151052, 0.413374752, 0.378598452, 0.353170365, 0.337616116, 0.322061896,
+        0.306507677, 0.290953428, 0.275399208, 0.259844959, 0.244290739, 0.22873652, 0.213182285, 0.197628051,
+        0.182073832, 0.166519597, 0.150965363, 0.108015455, 0.0236898027, -0.0606358461, -0.144961491, -0.229287148,
+        -0.313612789, -0.39793843, -0.482264102, -0.566589773, -0.650915384, -0.528502285, -0.401760817, -0.275019348,
+        -0.148277879, -0.0215364229, 0.105205037, 0.231946498, 0.358687967, 0.485429436, 0.612170875, 0.738912344,
+        0.865653813, 0.879105568, 0.847470403, 0.815835178, 0.784200013, 0.752564847, 0.720929682, 0.689294457,
+        0.657659292, 0.626024127, 0.594388902, 0.562753737, 0.531118572, 0.436063319, 0.292529047, 0.148994774,
+        0.00546051422, -0.138073757, -0.281608015, -0.425142288, -0.568676531, -0.712210834, -0.657055676, -0.619706213 },
+    // gendy~ cauchy
+    {
+        0, -0.0585978702, -0.11719574, -0.175793603, -0.234391481, -0.292989343, -0.351587206, -0.410185069,
+        -0.468782961, -0.527380824, -0.585978687, -0.64457655, -0.655025125, -0.644094646, -0.633164227, -0.622233748,
+        -0.61130327, -0.600372851, -0.589442372, -0.578511894, -0.567581475, -0.556650996, -0.545720518, -0.534790099,
+        -0.52385962, -0.512929142, -0.501998723, -0.491068244, -0.480137795, -0.469207317, -0.458276868, -0.447346419,
+        -0.436415941, -0.425485492, -0.414555013, -0.403624564, -0.392694116, -0.381763637, -0.357081115, -0.312844843,
+        -0.26860857, -0.224372283, -0.180135995, -0.135899723, -0.0916634426, -0.0474271625, -0.00319088413, 0.0410453938,
+        0.0852816775, 0.129517958, 0.17375423, 0.217990518, 0.26222679, 0.306463063, 0.350699365, 0.394935638,
+        0.43917191, 0.483408183, 0.443163186, 0.433957785, 0.424752384, 0.415546983, 0.406341583, 0.397136182,
+        0.387930781, 0.37872538, 0.369519949, 0.360314548, 0.351109147, 0.341903746, 0.332698345, 0.323492944,
+        0.314287543, 0.305082142, 0.295876741, 0.28667134, 0.27746594, 0.268260539, 0.259055138, 0.249849737,
+        0.240644336, 0.231438935, 0.222233534, 0.213028118, 0.203822717, 0.194617316, 0.185411915, 0.176206514,
+        0.167001113, 0.157795712, 0.148590311, 0.13938491, 0.13017951, 0.120974101, 0.1117687, 0.102563299,
+        0.0933578983, 0.0841524899, 0.074947089, 0.065741688, 0.0565362871, 0.0473308824, 0.0381254815, 0.0289200787,
+        0.0197146758, 0.010509274, 0.00130387174, -0.00790153071, -0.0171069335, -0.0263123345, -0.0355177373, -0.0447231382,
+        -0.0539285429, -0.0631339476, -0.0723393485, -0.0815447494, -0.0907501504, -0.0999555513, -0.109160952, -0.118366361,
+        -0.127571762, -0.136777163, -0.145982563, -0.155187964, -0.164393365, -0.173598766, -0.182804167, -0.192009583,
+        -0.201214984, -0.210420385, -0.219625786, -0.228831187, -0.238036588, -0.247241989, -0.256447405, -0.265652806,
+        -0.274858207, -0.284063607, -0.293269008, -0.302474409, -0.31167981, -0.320885211, -0.330090612, -0.337969214,
+        -0.367069274, -0.396169335, -0.425269395, -0.454369485, -0.483469546, -0.512569606, -0.541669667, -0.570769727,
+        -0.599869788, -0.628969848, -0.658069909, -0.687169969, -0.71627003, -0.74537009, -0.77447021, -0.803570271,
+        -0.792370975, -0.756588876, -0.720806837, -0.685024738, -0.649242699, -0.6134606, -0.577678561, -0.541896462,
+        -0.506114423, -0.470332354, -0.434550285, -0.398768216, -0.362986147, -0.327204078, -0.291422009, -0.255639941,
+        -0.209321871, -0.193419576, -0.177517265, -0.161614969, -0.145712674, -0.129810378, -0.113908075, -0.0980057791,
+        -0.0821034834, -0.0662011802, -0.0502988845, -0.0343965851, -0.0184942856, -0.00259198784, 0.0133103104, 0.0292126089,
+        0.0451149084, 0.0610172041, 0.0769195035, 0.0928217992, 0.108724102, 0.124626398, 0.140528694, 0.15643099,
+        0.1723333, 0.188235596, 0.204137892, 0.220040187, 0.235942483, 0.251844794, 0.267747074, 0.283649385,
+        0.299551696, 0.315453976, 0.331356287, 0.347258568, 0.363160878, 0.379063159, 0.39496547, 0.41086778,
+        0.426770061, 0.442672372, 0.458574653, 0.473685056, 0.444678009, 0.415670961, 0.386663944, 0.357656896,
+        0.328649849, 0.299642801, 0.270635784, 0.241628736, 0.212621689, 0.183614656, 0.154607609, 0.125600576,
+        0.096593529, 0.067586489, 0.0385794491, 0.00957240909, -0.0194346309, -0.0484416708, -0.0774487108, -0.106455751,
+        -0.135462791, -0.164469838, -0.193476871, -0.222483918, -0.251490951, -0.280497998, -0.309505045, -0.338512063,
+        -0.36751911, -0.396526158, -0.425533205, -0.453399658, -0.496028244, -0.538656831, -0.581285477, -0.623914063,
+        -0.666542649, -0.709171236, -0.751799881, -0.794428468, -0.837057054, -0.87968564, -0.922314227, -0.908743262,
+        -0.843302488, -0.777861714, -0.71242094, -0.646980226, -0.581539452, -0.516098678, -0.450657934, -0.38521716,
+        -0.319776416, -0.254335672, -0.188894898, -0.125675932, -0.119270697, -0.112865455, -0.106460221, -0.100054987,
+        -0.0936497524, -0.0872445181, -0.0808392838, -0.0744340494, -0.0680288076, -0.061623577, -0.055218339, -0.0488131046,
+        -0.0424078703, -0.0360026322, -0.0295973979, -0.0231921636, -0.0167869274, -0.0103816921, -0.00397645729, 0.00242877821,
+        0.00883401372, 0.015239249, 0.0216444843, 0.0280497205, 0.0344549567, 0.040860191, 0.0472654253, 0.0536706597,
+        0.0600758977, 0.0664811358, 0.0728863701, 0.0792916045, 0.0856968388, 0.0921020731, 0.0985073075, 0.104912542,
+        0.111317776, 0.117723018, 0.124128252, 0.130533487, 0.136938721, 0.143343955, 0.14974919, 0.156154424,
+        0.162559658, 0.168964893, 0.175370127, 0.181775376, 0.188180611, 0.194585845, 0.200991079, 0.207396314,
+        0.213801548, 0.220206782, 0.226612017, 0.233017251, 0.239422485, 0.24582772, 0.252232969, 0.258638203,
+        0.265043437, 0.271448672, 0.272628129, 0.264762074, 0.256896019, 0.249029964, 0.241163909, 0.233297855,
+        0.2254318, 0.217565745, 0.20969969, 0.201833636, 0.193967566, 0.186101511, 0.178235456, 0.170369402,
+        0.162503347, 0.154637292, 0.146771237, 0.138905182, 0.131039128, 0.123173073, 0.115307018, 0.107440963,
+        0.0995749086, 0.0917088538, 0.0838427991, 0.0759767443, 0.0681106895, 0.0602446347, 0.05237858, 0.0445125252,
+        0.0366464704, 0.0287804138, 0.020914359, 0.0130483033, 0.00518224761, -0.0026838074, -0.0105498629, -0.0184159186,
+        -0.0262819733, -0.03414803, -0.0420140848, -0.0498801395, -0.0577461943, -0.0656122491, -0.0734783038, -0.0813443586,
+        -0.0892104134, -0.0970764682, -0.104942523, -0.112808578, -0.120674632, -0.128540695, -0.136406749, -0.144272804,
+        -0.152138859, -0.160004914, -0.167870969, -0.175737023, -0.183603078, -0.191469133, -0.199335188, -0.207201242,
+        -0.215067297, -0.222933352, -0.230799407, -0.238665462, -0.246531516, -0.254397571, -0.262263626, -0.270129681,
+        -0.277995735, -0.28586179, -0.293727845, -0.3015939, -0.309459955, -0.317326009, -0.325192064, -0.333058119,
+        -0.340924174, -0.348790228, -0.356656283, -0.364522338, -0.372388393, -0.380254447, -0.388120502, -0.395986557,
+        -0.403852612, -0.411718667, -0.419584721, -0.427450776, -0.435316831, -0.442230672, -0.465600729, -0.488970816,
+        -0.512340903, -0.53571099, -0.559081078, -0.582451105, -0.605821192, -0.629191279, -0.652561367, -0.675931454,
+        -0.699301541, -0.722671628, -0.746041656, -0.769411743, -0.788541615, -0.739828169, -0.691114664, -0.642401218,
+        -0.593687713, -0.544974208, -0.496260762, -0.447547287, -0.398833781, -0.350120306, -0.301406831, -0.252693355,
+        -0.203979865, -0.155266389, -0.106552906, -0.0578394234, -0.0390411578, -0.0363698713, -0.0336985849, -0.0310273003,
+        -0.028356012, -0.0256847255, -0.023013439, -0.0203421526, -0.0176708661, -0.0149995796, -0.0123282932, -0.00965700578,
+        -0.00698571978, -0.00431443285, -0.00164314627, 0.00102814042, 0.003699427, 0.00637071347, 0.0090420004, 0.0117132869,
+        0.0143845733, 0.0170558598, 0.0197271463, 0.0223984327, 0.025069721, 0.0277410075, 0.030412294, 0.0330835804,
+        0.0357548669, 0.0384261534, 0.0410974398, 0.0437687263, 0.0464400128, 0.0491112992, 0.0517825857, 0.0544538721,
+        0.0571251586, 0.0597964451, 0.0624677315, 0.065139018, 0.0678103045, 0.0704815909, 0.0731528774, 0.0758241639,
+        0.0784954503, 0.0811667368, 0.0838380232, 0.0865093097, 0.0891805962, 0.0918518826, 0.0945231766, 0.097194463 },
+    // gendy~ logist hyperbcos
+    {
+        0, -0.115252152, -0.230504304, -0.345756441, -0.461008608, -0.576260746, -0.439644188, -0.238211438,
+        -0.0367786847, 0.164654076, 0.366086811, 0.451516271, 0.41577825, 0.380040258, 0.344302267, 0.308564246,
+        0.272826254, 0.107064582, -0.121774554, -0.350613683, -0.579452813, -0.808291972, -0.734754145, -0.498718351,
+        -0.262682527, -0.0266467296, 0.209389076, 0.345335692, 0.299688458, 0.254041255, 0.208394006, 0.162746787,
+        0.0630053654, -0.0564322621, -0.175869897, -0.295307517, -0.414745152, -0.534182787, -0.639421403, -0.47574237,
+        -0.312063396, -0.148384392, 0.0152946087, -0.0278510023, -0.175051942, -0.322252899, -0.469453841, -0.616654813,
+        -0.716188073, -0.561320305, -0.406452566, -0.251584798, -0.0967170373, 0.0581507199, 0.213018477, 0.329030275,
+        0.444123715, 0.559217155, 0.674310565, 0.788173914, 0.607685745, 0.427197605, 0.246709451, 0.0662213042,
+        -0.114266843, -0.151739195, 0.0825433359, 0.316825867, 0.55110842, 0.785390913, 0.911204934, 0.794905484,
+        0.678605974, 0.562306464, 0.446006984, 0.339644283, 0.355529726, 0.371415198, 0.38730067, 0.403186113,
+        0.419071585, 0.470961869, 0.55517602, 0.639390111, 0.723604262, 0.687331498, 0.434401929, 0.181472391,
+        -0.071457155, -0.324386716, -0.577316225, -0.57687372, -0.444164515, -0.311455339, -0.178746134, -0.0460369363,
+        0.0866722614, 0.101609863, 0.0742459595, 0.0468820557, 0.0195181519, -0.00784575101, 0.141591415, 0.277291954,
+        0.412992477, 0.548693001, 0.684393585, 0.820094109, 0.751172006, 0.550221443, 0.34927085, 0.148320258,
+        -0.0526303202, -0.098355636, -0.0851403475, -0.071925059, -0.0587097704, -0.0648387745, -0.0730292648, -0.0812197551,
+        -0.0894102454, -0.0976007432, -0.105791233, -0.139662817, -0.191013277, -0.242363751, -0.293714225, -0.359897822,
+        -0.414200693, -0.468503565, -0.522806466, -0.577109337, -0.631412208, -0.685715079, -0.502424359, -0.195969582,
+        0.110485174, 0.416939914, 0.723394692, 0.968022585, 0.730245054, 0.492467523, 0.254689991, 0.0169124585,
+        -0.220865071, -0.392942935, -0.389698505, -0.386454076, -0.383209616, -0.379965186, -0.326154321, -0.0722367987,
+        0.181680724, 0.435598254, 0.641362071, 0.660000741, 0.678639472, 0.697278142, 0.715916812, 0.734555542,
+        0.753194213, 0.602985442, 0.418923289, 0.234861165, 0.0507990345, -0.133263096, -0.310084254, -0.404626936,
+        -0.499169588, -0.59371227, -0.688254952, -0.782797635, -0.708636224, -0.59884584, -0.489055485, -0.37926513,
+        -0.269474775, -0.159684405, -0.0774428174, -0.0141716087, 0.0490996018, 0.112370811, 0.175642014, 0.238913223,
+        0.296810687, 0.347529352, 0.398248017, 0.448966712, 0.499685377, 0.550404012, 0.473647028, 0.158254385,
+        -0.157138243, -0.472530872, -0.787923515, -0.663247764, -0.554587305, -0.445926875, -0.337266415, -0.228605956,
+        -0.139107138, -0.171399638, -0.203692138, -0.235984638, -0.268277138, -0.300569654, -0.39083603, -0.530074418,
+        -0.669312775, -0.808551192, -0.94778955, -0.716972113, -0.469522983, -0.222073808, 0.0253753532, 0.272824526,
+        0.520273685, 0.350774705, 0.117556199, -0.115662307, -0.348880827, -0.582099319, -0.815317869, -0.93342346,
+        -0.654433668, -0.375443906, -0.0964541137, 0.182535663, 0.377875656, 0.441304088, 0.504732549, 0.568160951,
+        0.631589353, 0.695017815, 0.681911469, 0.459291428, 0.236671448, 0.0140514392, -0.208568558, -0.431188554,
+        -0.241813764, -0.0860160142, 0.0697817355, 0.225579485, 0.38137725, 0.537175, 0.497884303, 0.398982018,
+        0.300079733, 0.201177463, 0.10227517, 0.00337288831, 0.0641890317, 0.181061849, 0.297934651, 0.414807469,
+        0.531680286, 0.648553133, 0.701131344, 0.736540437, 0.77194953, 0.807358623, 0.842767715, 0.81489259,
+        0.500423372, 0.185954154, -0.128515065, -0.442984283, -0.757453501, -0.744756877, -0.562320828, -0.37988472,
+        -0.197448641, -0.0150125483, 0.167423546, 0.349859625, 0.33628723, 0.316076845, 0.295866489, 0.275656104,
+        0.255445749, 0.337880343, 0.441000819, 0.544121325, 0.647241771, 0.750362277, 0.661379576, 0.457293749,
+        0.253207922, 0.0491220877, -0.154963747, -0.359049588, -0.274768382, -0.157173857, -0.0395793393, 0.0780151784,
+        0.195609689, 0.153369024, 0.0148935542, -0.123581916, -0.262057394, -0.400532871, -0.497094393, -0.421648055,
+        -0.346201748, -0.27075541, -0.195309103, -0.11986278, -0.121082768, -0.260596275, -0.400109768, -0.53962326,
+        -0.679136813, -0.818650305, -0.958163798, -0.776716113, -0.514878988, -0.253041834, 0.00879527442, 0.270632386,
+        0.532469511, 0.295869708, 0.0893153548, -0.117238991, -0.323793322, -0.530347645, -0.736901999, -0.815789282,
+        -0.751058102, -0.686326921, -0.62159574, -0.55686456, -0.492133349, -0.427402139, -0.312913954, -0.140718669,
+        0.031476602, 0.203671873, 0.375867158, 0.530823231, 0.573120475, 0.615417719, 0.657714963, 0.700012207,
+        0.742309451, 0.614487588, 0.432743996, 0.251000434, 0.0692568719, -0.112486698, -0.265816361, -0.354180187,
+        -0.442544043, -0.530907869, -0.619271696, -0.707635522, -0.714137971, -0.53641063, -0.358683318, -0.180956021,
+        -0.00322870072, 0.174498618, 0.352225929, 0.283134967, 0.201221466, 0.119307943, 0.0373944268, -0.0445190929,
+        -0.126432613, -0.051296521, 0.144229725, 0.339755982, 0.535282254, 0.730808496, 0.814756453, 0.435444087,
+        0.0561317503, -0.323180586, -0.702492952, -0.737147987, -0.659206748, -0.581265509, -0.50332427, -0.425383031,
+        -0.347441792, -0.342364997, -0.411013901, -0.479662836, -0.54831177, -0.616960704, -0.685609639, -0.754258573,
+        -0.786240697, -0.814915121, -0.843589544, -0.872263968, -0.900938392, -0.627375305, -0.333936483, -0.0404976085,
+        0.252941251, 0.546380103, 0.839818954, 0.709399581, 0.313844115, -0.0817113221, -0.477266759, -0.872822225,
+        -0.80806458, -0.593570232, -0.379075855, -0.164581507, 0.0499128588, 0.201951623, 0.328767896, 0.455584168,
+        0.582400441, 0.709216714, 0.57017231, 0.335846096, 0.101519868, -0.132806361, -0.367132604, -0.480185688,
+        -0.192102358, 0.0959809944, 0.384064347, 0.672147691, 0.794564426, 0.643274009, 0.491983563, 0.340693116,
+        0.189402685, 0.0381122418, -0.113178194, -0.0519438274, 0.109271742, 0.270487309, 0.431702882, 0.592918456,
+        0.73116982, 0.766325474, 0.801481128, 0.836636782, 0.871792436, 0.90694809, 0.820031703, 0.585356414,
+        0.350681096, 0.116005816, -0.11866948, -0.353344768, -0.588020086, -0.471830249, -0.210833281, 0.0501636639,
+        0.311160624, 0.572157562, 0.677072108, 0.590461552, 0.503850996, 0.417240471, 0.330629915, 0.244019359,
+        0.157408819, 0.219520852, 0.316882849, 0.41424486, 0.511606872, 0.608968854, 0.706330836, 0.562337101,
+        0.326791584, 0.0912461206, -0.144299358, -0.379844844, -0.615390301, -0.697390676, -0.476261556, -0.255132407,
+        -0.0340032727, 0.187125862, 0.408255011, 0.495264709, 0.235087618, -0.0250894707, -0.285266548, -0.545443654,
+        -0.720826209, -0.604783893, -0.488741547, -0.372699201, -0.256656855, -0.140614524, -0.0347926915, -0.19383809,
+        -0.352883488, -0.511928856, -0.670974255, -0.830019653, -0.818891525, -0.513936877, -0.208982185, 0.0959724709,
+        0.400927126, 0.705881774, 0.789887667, 0.41176337, 0.0336390473, -0.344485283, -0.72260958, -0.976935446 },
+    // gendy~ arcsine expon
+    {
+        0, 0.0725041032, 0.145008206, 0.21751231, 0.290016413, 0.362520516, 0.435024619, 0.507528722,
+        0.580032825, 0.652536929, 0.725041032, 0.774153531, 0.687382579, 0.600611567, 0.513840616, 0.427069634,
+        0.340298682, 0.253527701, 0.166756719, 0.0799857527, -0.00678522326, -0.0935561955, -0.06538333, -0.00105151755,
+        0.0632802993, 0.127612114, 0.191943929, 0.256275743, 0.320607543, 0.384939373, 0.449271172, 0.513602972,
+        0.577934802, 0.642266631, 0.572685957, 0.455365479, 0.338045031, 0.220724598, 0.103404164, -0.0139162801,
+        -0.131236717, -0.248557165, -0.263754874, -0.185232207, -0.106709547, -0.0281868782, 0.0503357872, 0.128858447,
+        0.207381114, 0.285903782, 0.364426464, 0.372623414, 0.283080697, 0.19353801, 0.103995316, 0.0144526213,
+        -0.075090073, -0.164632767, -0.254175454, -0.343718171, -0.433260858, -0.522803545, -0.612346232, -0.701888919,
+        -0.791431665, -0.880974352, -0.904117525, -0.805908978, -0.707700431, -0.609491885, -0.511283338, -0.413074791,
+        -0.314866275, -0.216657713, -0.118449174, -0.0202406291, 0.00411796523, -0.0836664811, -0.171450928, -0.259235352,
+        -0.347019821, -0.434804261, -0.52258867, -0.610373139, -0.698157609, -0.785942018, -0.784367561, -0.558713853,
+        -0.333060175, -0.107406475, 0.118247218, 0.343900919, 0.569554627, 0.795208275, 0.692197859, 0.480624139,
+        0.269050419, 0.0574766919, -0.154097036, -0.36567077, -0.577244461, -0.733256757, -0.722711802, -0.712166846,
+        -0.70162195, -0.691076994, -0.680532038, -0.669987082, -0.659442186, -0.648897231, -0.638352275, -0.627807319,
+        -0.617262363, -0.606717467, -0.596172512, -0.585627556, -0.5750826, -0.564537704, -0.553992748, -0.543447793,
+        -0.532902837, -0.522357941, -0.511812985, -0.501268029, -0.490723103, -0.480178148, -0.453170478, -0.42760095,
+        -0.402031392, -0.376461864, -0.350892335, -0.325322807, -0.299753278, -0.27418375, -0.248614207, -0.223044679,
+        -0.197475135, -0.171905607, -0.146336079, -0.120766543, -0.0951970071, -0.0696274787, -0.0440579429, -0.0184884109,
+        0.00708112121, 0.0326506533, 0.0582201853, 0.0837897211, 0.109359249, 0.134928778, 0.160498321, 0.186067849,
+        0.211637378, 0.237206921, 0.262776434, 0.288345993, 0.313915521, 0.339485049, 0.365054578, 0.390624106,
+        0.416193634, 0.441763192, 0.467332721, 0.471504718, 0.453442067, 0.435379416, 0.417316765, 0.399254113,
+        0.381191462, 0.363128811, 0.34506616, 0.327003509, 0.308940887, 0.290878236, 0.253859669, 0.175083384,
+        0.0963071138, 0.0175308362, -0.0612454377, -0.140021712, -0.218797982, -0.297574252, -0.376350522, -0.455126792,
+        -0.474349588, -0.42885223, -0.383354872, -0.337857515, -0.292360157, -0.246862799, -0.201365441, -0.155868083,
+        -0.110370718, -0.0648733601, -0.0193760023, 0.0261213575, 0.0716187134, 0.0957534611, -0.0372134186, -0.170180291,
+        -0.303147167, -0.436114043, -0.569080949, -0.702047825, -0.835014701, -0.967981577, -0.838867426, -0.709262013,
+        -0.579656601, -0.450051188, -0.320445776, -0.190840364, -0.061234951, 0.0683704615, 0.197975874, 0.27424553,
+        0.224296406, 0.174347267, 0.124398127, 0.0744489878, 0.0244998503, -0.0254492871, -0.0753984228, -0.12534757,
+        -0.175296694, -0.225245833, -0.275194973, -0.325144112, -0.331203252, -0.247077733, -0.162952229, -0.078826718,
+        0.00529878493, 0.0894242898, 0.173549801, 0.25767532, 0.341800809, 0.370230377, 0.290410548, 0.210590675,
+        0.130770832, 0.0509509705, -0.028868882, -0.108688734, -0.188508585, -0.268328428, -0.348148286, -0.427968144,
+        -0.472078651, -0.346668899, -0.221259117, -0.0958493352, 0.0295604374, 0.154970214, 0.280379981, 0.405789763,
+        0.351980984, 0.215681061, 0.0793811381, -0.0569187738, -0.193218693, -0.329518616, -0.465818524, -0.579319,
+        -0.59017396, -0.601028919, -0.611883879, -0.622738838, -0.633593798, -0.644448757, -0.655303717, -0.666158676,
+        -0.677013636, -0.687868595, -0.698723555, -0.709578514, -0.720433474, -0.731288433, -0.742143393, -0.752998352,
+        -0.763853312, -0.774708271, -0.785563231, -0.79641819, -0.807273149, -0.818128109, -0.828983068, -0.839838028,
+        -0.850692987, -0.861547947, -0.872402906, -0.883257866, -0.819472194, -0.76984483, -0.720217407, -0.670590043,
+        -0.620962679, -0.571335316, -0.521707952, -0.472080588, -0.422453195, -0.372825831, -0.323198467, -0.273571104,
+        -0.223943725, -0.174316347, -0.124688976, -0.0750616044, -0.0254342351, 0.024193136, 0.073820509, 0.12344788,
+        0.173075244, 0.222702622, 0.272329986, 0.32195735, 0.371584743, 0.421212107, 0.470839471, 0.520466864,
+        0.570094228, 0.619721591, 0.669348955, 0.718976319, 0.768603683, 0.818231046, 0.867858469, 0.917485833,
+        0.967113197, 0.991771698, 0.985430777, 0.979089856, 0.972748935, 0.966407955, 0.960067034, 0.953726113,
+        0.947385192, 0.941044271, 0.93470335, 0.92836237, 0.922021449, 0.913721383, 0.759556532, 0.605391681,
+        0.45122683, 0.29706201, 0.142897159, -0.0112676919, -0.165432543, -0.319597393, -0.473762214, -0.627927065,
+        -0.544990301, -0.480078489, -0.415166676, -0.350254864, -0.285343051, -0.220431253, -0.155519441, -0.0906076431,
+        -0.0256958343, 0.0392159745, 0.10412778, 0.169039592, 0.23395139, 0.278977394, 0.199675471, 0.120373555,
+        0.0410716459, -0.0382302664, -0.117532179, -0.196834087, -0.276136011, -0.355437905, -0.348753393, -0.336066008,
+        -0.323378593, -0.310691178, -0.298003793, -0.285316378, -0.272628993, -0.259941578, -0.247254178, -0.234566778,
+        -0.248842329, -0.307653397, -0.366464496, -0.425275564, -0.484086633, -0.542897701, -0.60170877, -0.660519838,
+        -0.719330966, -0.778142035, -0.836953104, -0.895764172, -0.75662148, -0.545151412, -0.333681285, -0.122211181,
+        0.0892589241, 0.300729036, 0.512199104, 0.723669231, 0.84114033, 0.730023503, 0.618906617, 0.507789731,
+        0.396672875, 0.285556018, 0.174439147, 0.0633222908, -0.0477945767, -0.158911437, -0.270028293, -0.326149553,
+        -0.152167097, 0.021815367, 0.195797831, 0.369780302, 0.543762743, 0.717745245, 0.891727686, 0.757371664,
+        0.524567068, 0.291762471, 0.0589579009, -0.173846677, -0.406651258, -0.639455855, -0.816765726, -0.806844532,
+        -0.79692328, -0.787002027, -0.777080834, -0.767159581, -0.757238328, -0.747317076, -0.737395883, -0.72747463,
+        -0.717553377, -0.707632184, -0.697710931, -0.687789679, -0.677868426, -0.667947233, -0.65802598, -0.648104727,
+        -0.638183534, -0.628262281, -0.618341029, -0.608419776, -0.598498583, -0.58857733, -0.578656077, -0.568734825,
+        -0.558813632, -0.548892379, -0.538971126, -0.529049933, -0.51912868, -0.509207428, -0.494516969, -0.474673212,
+        -0.454829484, -0.434985727, -0.415142, -0.395298243, -0.375454515, -0.355610758, -0.335767001, -0.315923274,
+        -0.296079516, -0.276235789, -0.256392032, -0.23654829, -0.216704547, -0.196860805, -0.177017063, -0.157173306,
+        -0.137329563, -0.117485821, -0.097642079, -0.0777983367, -0.0579545908, -0.0381108448, -0.0182671007, 0.00157664402,
+        0.0214203894, 0.0397627316, 0.0746277794, 0.109492831, 0.14435789, 0.179222941, 0.214087993, 0.248953044,
+        0.283818096, 0.318683147, 0.353548199, 0.38841325, 0.423278302, 0.458143353, 0.352456927, 0.22264868,
+        0.092840448, -0.0369677842, -0.166776016, -0.296584249, -0.426392496, -0.556200743, -0.68600893, -0.815817177 },
+    // gendy~ single point
+    {
+        0, -0.0103379888, -0.0206759777, -0.0310139675, -0.0413519554, -0.0516899452, -0.0620279349, -0.0723659247,
+        -0.0827039108, -0.0930418968, -0.10337989, -0.113717876, -0.12405587, -0.134393856, -0.144731849, -0.155069828,
+        -0.165407822, -0.175745815, -0.186083794, -0.196421787, -0.206759781, -0.217097759, -0.227435753, -0.237773746,
+        -0.24811174, -0.258449733, -0.268787712, -0.27912569, -0.289463699, -0.299801677, -0.310139656, -0.320477664,
+        -0.330815643, -0.341153622, -0.35149163, -0.361829609, -0.372167587, -0.382505596, -0.392843574, -0.403181553,
+        -0.413519561, -0.42385754, -0.434195518, -0.444533527, -0.454871505, -0.445831656, -0.434638679, -0.423445702,
+        -0.412252724, -0.401059747, -0.389866799, -0.378673822, -0.367480844, -0.356287867, -0.345094889, -0.333901912,
+        -0.322708964, -0.311515987, -0.300323009, -0.289130032, -0.277937055, -0.266744107, -0.25555113, -0.244358152,
+        -0.233165175, -0.221972197, -0.210779235, -0.199586257, -0.18839328, -0.177200317, -0.16600734, -0.154814363,
+        -0.1436214, -0.132428423, -0.121235453, -0.110042475, -0.0988495052, -0.0876565352, -0.0764635578, -0.0652705878,
+        -0.0540776178, -0.0428846441, -0.0316916704, -0.0204986986, -0.00930572674, 0.00188724545, 0.0130802179, 0.0242731906,
+        0.0354661644, 0.0454172902, 0.055057954, 0.0646986216, 0.074339278, 0.0839799419, 0.0936206058, 0.10326127,
+        0.112901933, 0.122542597, 0.132183269, 0.141823933, 0.151464596, 0.16110526, 0.170745924, 0.180386588,
+        0.190027252, 0.199667916, 0.20930858, 0.218949243, 0.228589907, 0.238230571, 0.24787122, 0.257511884,
+        0.267152548, 0.276793212, 0.286433876, 0.296074539, 0.305715203, 0.315355867, 0.324996531, 0.334637195,
+        0.344277859, 0.353918523, 0.363559186, 0.37319985, 0.382840514, 0.392481178, 0.402121842, 0.411762506,
+        0.42140317, 0.431043833, 0.440684497, 0.450325161, 0.459965825, 0.469682813, 0.479432464, 0.489182144,
+        0.498931825, 0.508681476, 0.518431187, 0.528180838, 0.537930489, 0.547680199, 0.55742985, 0.567179561,
+        0.576929212, 0.586678863, 0.596428573, 0.606178224, 0.615927875, 0.625677586, 0.635427237, 0.645176947,
+        0.654926598, 0.664676249, 0.67442596, 0.684175611, 0.693925321, 0.703674972, 0.713424623, 0.723174334,
+        0.732923985, 0.742673635, 0.752423346, 0.762172997, 0.771922708, 0.781672359, 0.791422009, 0.80117172,
+        0.810921371, 0.820671022, 0.830420732, 0.840170383, 0.849920094, 0.859669745, 0.869419396, 0.879169106,
+        0.888918757, 0.892198086, 0.891163826, 0.890129507, 0.889095247, 0.888060927, 0.887026668, 0.885992348,
+        0.884958088, 0.883923769, 0.882889509, 0.88185519, 0.88082093, 0.879786611, 0.878752351, 0.877718031,
+        0.876683772, 0.875649512, 0.874615192, 0.873580933, 0.872546613, 0.871512353, 0.870478034, 0.869443774,
+        0.868409455, 0.867375195, 0.866340876, 0.865306616, 0.864272296, 0.863238037, 0.862203717, 0.861169457,
+        0.860135138, 0.859100878, 0.858066559, 0.857032299, 0.85599798, 0.85496372, 0.85392946, 0.852895141,
+        0.851860881, 0.850826561, 0.849792302, 0.848757982, 0.847723722, 0.846391499, 0.844761312, 0.843131125,
+        0.841500938, 0.839870811, 0.838240623, 0.836610436, 0.834980249, 0.833350122, 0.831719935, 0.830089748,
+        0.828459561, 0.826829433, 0.825199246, 0.823569059, 0.821938872, 0.820308745, 0.818678558, 0.817048371,
+        0.815418184, 0.813788056, 0.812157869, 0.810527682, 0.808897495, 0.807267368, 0.805637181, 0.804006994,
+        0.802376807, 0.800746679, 0.799116492, 0.797486305, 0.795856118, 0.794225991, 0.792595804, 0.790965617,
+        0.78933543, 0.787705302, 0.786075115, 0.784444928, 0.782814741, 0.781184614, 0.779554427, 0.77792424,
+        0.776294053, 0.775502443, 0.775968611, 0.776434779, 0.776900947, 0.777367115, 0.777833343, 0.77829951,
+        0.778765678, 0.779231846, 0.779698014, 0.780164182, 0.78063035, 0.781096518, 0.781562686, 0.782028913,
+        0.782495081, 0.782961249, 0.783427417, 0.783893585, 0.784359753, 0.784825921, 0.785292089, 0.785758317,
+        0.786224484, 0.786690652, 0.78715682, 0.787622988, 0.788089156, 0.788555324, 0.789021492, 0.78948772,
+        0.789953887, 0.790420055, 0.790886223, 0.791352391, 0.791818559, 0.792284727, 0.792750895, 0.793217123,
+        0.79368329, 0.794149458, 0.794615626, 0.795081794, 0.795547962, 0.796511292, 0.798634529, 0.800757825,
+        0.802881122, 0.805004418, 0.807127714, 0.80925101, 0.811374307, 0.813497543, 0.81562084, 0.817744136,
+        0.819867432, 0.821990728, 0.824114025, 0.826237321, 0.828360558, 0.830483854, 0.83260715, 0.834730446,
+        0.836853743, 0.838977039, 0.841100276, 0.843223572, 0.845346868, 0.847470164, 0.849593461, 0.851716757,
+        0.853840053, 0.85596329, 0.858086586, 0.860209882, 0.862333179, 0.864456475, 0.866579771, 0.868703008,
+        0.870826304, 0.8729496, 0.875072896, 0.877196193, 0.879319489, 0.881442785, 0.883566022, 0.885689318,
+        0.887812614, 0.888603985, 0.884067535, 0.879531085, 0.874994636, 0.870458186, 0.865921736, 0.861385286,
+        0.856848836, 0.852312386, 0.847775936, 0.843239486, 0.838703036, 0.834166586, 0.829630136, 0.825093687,
+        0.820557237, 0.816020787, 0.811484337, 0.806947887, 0.802411437, 0.797874928, 0.793338478, 0.788802028,
+        0.784265578, 0.779729128, 0.775192678, 0.770656228, 0.766119778, 0.761583328, 0.757046878, 0.752510428,
+        0.747973979, 0.743437529, 0.738901079, 0.734364629, 0.729828179, 0.725291729, 0.720755279, 0.716218829,
+        0.711682379, 0.707145929, 0.702609479, 0.69807303, 0.69353652, 0.689045846, 0.684967279, 0.680888653,
+        0.676810026, 0.6727314, 0.668652773, 0.664574146, 0.66049552, 0.656416893, 0.652338266, 0.648259699,
+        0.644181073, 0.640102446, 0.636023819, 0.631945193, 0.627866566, 0.62378794, 0.619709313, 0.615630686,
+        0.611552119, 0.607473493, 0.603394866, 0.599316239, 0.595237613, 0.591158986, 0.587080359, 0.583001733,
+        0.578923106, 0.574844539, 0.570765913, 0.566687286, 0.562608659, 0.558530033, 0.554451406, 0.550372779,
+        0.546294153, 0.542215526, 0.538136959, 0.534058332, 0.529979706, 0.525901079, 0.521822453, 0.517743826,
+        0.513665199, 0.509586573, 0.511789024, 0.513991535, 0.516194046, 0.518396556, 0.520599067, 0.522801578,
+        0.525004089, 0.5272066, 0.529409111, 0.531611621, 0.533814132, 0.536016643, 0.538219154, 0.540421665,
+        0.542624176, 0.544826686, 0.547029197, 0.549231708, 0.551434219, 0.55363673, 0.555839241, 0.558041751,
+        0.560244262, 0.562446773, 0.564649284, 0.566851795, 0.569054246, 0.571256757, 0.573459268, 0.575661778,
+        0.577864289, 0.5800668, 0.582269311, 0.584471822, 0.586674333, 0.588876843, 0.591079354, 0.593281865,
+        0.595484376, 0.597686887, 0.599889398, 0.602091908, 0.604294419, 0.60649693, 0.603525102, 0.599978328,
+        0.596431494, 0.592884719, 0.589337885, 0.585791111, 0.582244277, 0.578697503, 0.575150669, 0.571603894,
+        0.56805706, 0.564510286, 0.560963452, 0.557416677, 0.553869843, 0.550323069, 0.546776295, 0.543229461,
+        0.539682686, 0.536135852, 0.532589078, 0.529042244, 0.52549547, 0.521948636, 0.518401861, 0.514855027 },
+};
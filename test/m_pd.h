@@ -0,0 +1,143 @@
+#pragma once
+
+// A minimal stand-in for Pd's m_pd.h
+//
+// Only the part of the API used by bruits is declared here, with the same
+// names and signatures as the real header, so that the externals can be
+// compiled unchanged against the fake runtime in pd_host.c for tests and
+// benchmarks. Never install or ship this file.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PD_MAJOR_VERSION 0
+#define PD_MINOR_VERSION 54
+#define PD_BUGFIX_VERSION 0
+
+typedef intptr_t t_int;
+typedef float t_float;
+typedef float t_floatarg;
+typedef float t_sample;
+
+typedef struct _symbol {
+    const char* s_name;
+    struct _class** s_thing;
+    struct _symbol* s_next;
+} t_symbol;
+
+typedef struct _class t_class;
+typedef struct _outlet t_outlet;
+typedef struct _inlet t_inlet;
+
+typedef t_class* t_pd;
+
+typedef struct _gobj {
+    t_pd g_pd;
+    struct _gobj* g_next;
+} t_gobj;
+
+typedef struct _text {
+    t_gobj te_g;
+    t_outlet* te_outlet;
+    t_inlet* te_inlet;
+} t_text;
+
+typedef struct _text t_object;
+
+#define ob_pd te_g.g_pd
+
+typedef enum {
+    A_NULL,
+    A_FLOAT,
+    A_SYMBOL,
+    A_POINTER,
+    A_SEMI,
+    A_COMMA,
+    A_DEFFLOAT,
+    A_DEFSYM,
+    A_DOLLAR,
+    A_DOLLSYM,
+    A_GIMME,
+    A_CANT
+} t_atomtype;
+
+union word {
+    t_float w_float;
+    t_symbol* w_symbol;
+    int w_index;
+};
+
+typedef struct _atom {
+    t_atomtype a_type;
+    union word a_w;
+} t_atom;
+
+#define SETFLOAT(atom, f) ((atom)->a_type = A_FLOAT, (atom)->a_w.w_float = (f))
+#define SETSYMBOL(atom, s) ((atom)->a_type = A_SYMBOL, (atom)->a_w.w_symbol = (s))
+
+typedef void (*t_method)(void);
+typedef void* (*t_newmethod)(void);
+typedef t_int* (*t_perfroutine)(t_int* args);
+
+typedef struct _signal {
+    int s_n;
+    t_sample* s_vec;
+    t_float s_sr;
+    int s_nchans;
+} t_signal;
+
+#define CLASS_DEFAULT 0
+#define CLASS_PD 1
+#define CLASS_GOBJ 2
+#define CLASS_PATCHABLE 3
+#define CLASS_NOINLET 8
+#define CLASS_MULTICHANNEL 0x10
+
+extern t_symbol s_signal;
+extern t_symbol s_float;
+extern t_symbol s_symbol;
+extern t_symbol s_list;
+extern t_symbol s_bang;
+extern t_symbol s_anything;
+extern t_symbol s_;
+
+t_symbol* gensym(const char* s);
+
+void* getbytes(size_t nbytes);
+void* resizebytes(void* x, size_t oldsize, size_t newsize);
+void freebytes(void* x, size_t nbytes);
+
+t_float atom_getfloat(const t_atom* a);
+t_float atom_getfloatarg(int which, int argc, const t_atom* argv);
+t_symbol* atom_getsymbol(const t_atom* a);
+
+t_class* class_new(t_symbol* name, t_newmethod newmethod, t_method freemethod,
+    size_t size, int flags, t_atomtype arg1, ...);
+void class_addmethod(t_class* c, t_method fn, t_symbol* sel, t_atomtype arg1, ...);
+void class_domainsignalin(t_class* c, int onset);
+void class_addanything(t_class* c, t_method fn);
+
+#define CLASS_MAINSIGNALIN(c, type, field) \
+    class_domainsignalin(c, (int)offsetof(type, field))
+
+void nullfn(void);
+
+t_pd* pd_new(t_class* cls);
+void pd_free(t_pd* x);
+void pd_bind(t_pd* x, t_symbol* s);
+void pd_unbind(t_pd* x, t_symbol* s);
+
+t_outlet* outlet_new(t_object* owner, t_symbol* s);
+void outlet_free(t_outlet* x);
+void outlet_list(t_outlet* x, t_symbol* s, int argc, t_atom* argv);
+
+t_inlet* inlet_new(t_object* owner, t_pd* dest, t_symbol* s1, t_symbol* s2);
+
+void dsp_add(t_perfroutine f, int n, ...);
+void signal_setmultiout(t_signal** sig, int nchans);
+
+t_float sys_getsr(void);
+int sys_getblksize(void);
+
+void post(const char* fmt, ...);
+void pd_error(const void* object, const char* fmt, ...);
@@ -0,0 +1,691 @@
+#include "pd_host.h"
+
+#include <assert.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HOST_MAXCHAIN 16
+
+typedef struct _host_method {
+    t_symbol* sel;
+    t_method fn;
+    t_atomtype args[HOST_MAXARGS];
+    int nargs;
+} t_host_method;
+
+struct _class {
+    t_symbol* c_name;
+    t_method c_new;
+    t_method c_free;
+    size_t c_size;
+    int c_flags;
+    t_atomtype c_args[HOST_MAXARGS];
+    int c_nargs;
+
+    t_host_method* c_methods;
+    int c_nmethods;
+    int c_signalin;
+    t_method c_anything;
+
+    struct _class* c_next;
+};
+
+struct _outlet {
+    t_object* o_owner;
+    t_symbol* o_sym;
+    struct _outlet* o_next;
+};
+
+struct _inlet {
+    t_object* i_owner;
+    t_symbol* i_sym;
+    struct _inlet* i_next;
+};
+
+// per object dsp context: signal vectors and the perform routines added
+typedef struct _host_dsp {
+    t_object* d_owner;
+    int d_n;
+    int d_nin;
+    int d_nout;
+    t_signal* d_sig;
+    t_signal** d_sp;
+    t_int* d_chain[HOST_MAXCHAIN];
+    int d_nchain;
+    struct _host_dsp* d_next;
+} t_host_dsp;
+
+t_symbol s_signal = { "signal", 0, 0 };
+t_symbol s_float = { "float", 0, 0 };
+t_symbol s_symbol = { "symbol", 0, 0 };
+t_symbol s_list = { "list", 0, 0 };
+t_symbol s_bang = { "bang", 0, 0 };
+t_symbol s_anything = { "anything", 0, 0 };
+t_symbol s_ = { "", 0, 0 };
+
+static t_symbol* host_symbols;
+static t_class* host_classes;
+static t_host_dsp* host_dsps;
+static t_host_dsp* host_building;
+
+static t_float host_sr = 44100;
+static int host_blocksize = 64;
+static char host_post[1024];
+static t_atom host_list[HOST_MAXARGS];
+static int host_nlist;
+
+// --- memory
+
+void* getbytes(size_t nbytes)
+{
+    return calloc(1, nbytes ? nbytes : 1);
+}
+
+void* resizebytes(void* x, size_t oldsize, size_t newsize)
+{
+    char* y = realloc(x, newsize ? newsize : 1);
+    if (y && newsize > oldsize)
+        memset(y + oldsize, 0, newsize - oldsize);
+    return y;
+}
+
+void freebytes(void* x, size_t nbytes)
+{
+    (void)nbytes;
+    free(x);
+}
+
+// --- symbols and atoms
+
+t_symbol* gensym(const char* s)
+{
+    t_symbol* builtin[] = { &s_signal, &s_float, &s_symbol, &s_list, &s_bang, &s_anything, &s_ };
+    for (size_t i = 0; i < sizeof(builtin) / sizeof(builtin[0]); i++) {
+        if (!strcmp(builtin[i]->s_name, s))
+            return builtin[i];
+    }
+
+    for (t_symbol* sym = host_symbols; sym; sym = sym->s_next) {
+        if (!strcmp(sym->s_name, s))
+            return sym;
+    }
+
+    t_symbol* sym = getbytes(sizeof(t_symbol));
+    char* name = getbytes(strlen(s) + 1);
+    strcpy(name, s);
+    sym->s_name = name;
+    sym->s_next = host_symbols;
+    host_symbols = sym;
+    return sym;
+}
+
+t_float atom_getfloat(const t_atom* a)
+{
+    return a->a_type == A_FLOAT ? a->a_w.w_float : 0;
+}
+
+t_float atom_getfloatarg(int which, int argc, const t_atom* argv)
+{
+    if (which < 0 || which >= argc)
+        return 0;
+    return atom_getfloat(argv + which);
+}
+
+t_symbol* atom_getsymbol(const t_atom* a)
+{
+    return a->a_type == A_SYMBOL ? a->a_w.w_symbol : &s_symbol;
+}
+
+// --- classes
+
+static void host_argtypes(t_atomtype* types, int* n, t_atomtype arg1, va_list ap)
+{
+    *n = 0;
+    for (t_atomtype t = arg1; t != A_NULL; t = (t_atomtype)va_arg(ap, int)) {
+        assert(*n < HOST_MAXARGS);
+        types[(*n)++] = t;
+    }
+}
+
+t_class* class_new(t_symbol* name, t_newmethod newmethod, t_method freemethod,
+    size_t size, int flags, t_atomtype arg1, ...)
+{
+    t_class* c = getbytes(sizeof(t_class));
+    c->c_name = name;
+    c->c_new = (t_method)newmethod;
+    c->c_free = freemethod;
+    c->c_size = size;
+    c->c_flags = flags;
+    c->c_signalin = -1;
+
+    va_list ap;
+    va_start(ap, arg1);
+    host_argtypes(c->c_args, &c->c_nargs, arg1, ap);
+    va_end(ap);
+
+    c->c_next = host_classes;
+    host_classes = c;
+    return c;
+}
+
+void class_addmethod(t_class* c, t_method fn, t_symbol* sel, t_atomtype arg1, ...)
+{
+    c->c_methods = realloc(c->c_methods, (c->c_nmethods + 1) * sizeof(t_host_method));
+    t_host_method* m = &c->c_methods[c->c_nmethods++];
+    m->sel = sel;
+    m->fn = fn;
+
+    va_list ap;
+    va_start(ap, arg1);
+    host_argtypes(m->args, &m->nargs, arg1, ap);
+    va_end(ap);
+
+    if (sel == &s_signal)
+        c->c_signalin = 0;
+}
+
+void class_domainsignalin(t_class* c, int onset)
+{
+    c->c_signalin = onset;
+}
+
+void class_addanything(t_class* c, t_method fn)
+{
+    c->c_anything = fn;
+}
+
+void nullfn(void)
+{
+}
+
+static t_class* host_findclass(const char* name)
+{
+    for (t_class* c = host_classes; c; c = c->c_next) {
+        if (!strcmp(c->c_name->s_name, name))
+            return c;
+    }
+    return 0;
+}
+
+static t_host_method* host_findmethod(t_class* c, t_symbol* sel)
+{
+    for (int i = 0; i < c->c_nmethods; i++) {
+        if (c->c_methods[i].sel == sel)
+            return &c->c_methods[i];
+    }
+    return 0;
+}
+
+// --- objects
+
+t_pd* pd_new(t_class* cls)
+{
+    t_object* x = getbytes(cls->c_size);
+    x->ob_pd = cls;
+    return &x->ob_pd;
+}
+
+void pd_free(t_pd* x)
+{
+    t_object* ob = (t_object*)x;
+    t_class* c = *x;
+
+    if (c->c_free)
+        ((void (*)(t_pd*))c->c_free)(x);
+
+    while (ob->te_outlet)
+        outlet_free(ob->te_outlet);
+
+    while (ob->te_inlet) {
+        t_inlet* next = ob->te_inlet->i_next;
+        freebytes(ob->te_inlet, sizeof(t_inlet));
+        ob->te_inlet = next;
+    }
+
+    freebytes(x, c->c_size);
+}
+
+// one object per name, which is all bruits binds
+void pd_bind(t_pd* x, t_symbol* s)
+{
+    assert(!s->s_thing);
+    s->s_thing = x;
+}
+
+void pd_unbind(t_pd* x, t_symbol* s)
+{
+    if (s->s_thing == x)
+        s->s_thing = 0;
+}
+
+t_outlet* outlet_new(t_object* owner, t_symbol* s)
+{
+    t_outlet* o = getbytes(sizeof(t_outlet));
+    o->o_owner = owner;
+    o->o_sym = s;
+
+    t_outlet** tail = &owner->te_outlet;
+    while (*tail)
+        tail = &(*tail)->o_next;
+    *tail = o;
+    return o;
+}
+
+void outlet_free(t_outlet* x)
+{
+    t_outlet** o = &x->o_owner->te_outlet;
+    while (*o && *o != x)
+        o = &(*o)->o_next;
+    if (*o)
+        *o = x->o_next;
+    freebytes(x, sizeof(t_outlet));
+}
+
+void outlet_list(t_outlet* x, t_symbol* s, int argc, t_atom* argv)
+{
+    (void)x;
+    (void)s;
+
+    host_nlist = argc < HOST_MAXARGS ? argc : HOST_MAXARGS;
+    memcpy(host_list, argv, host_nlist * sizeof(t_atom));
+}
+
+t_inlet* inlet_new(t_object* owner, t_pd* dest, t_symbol* s1, t_symbol* s2)
+{
+    (void)dest;
+    (void)s1;
+
+    t_inlet* in = getbytes(sizeof(t_inlet));
+    in->i_owner = owner;
+    in->i_sym = s2;
+
+    t_inlet** tail = &owner->te_inlet;
+    while (*tail)
+        tail = &(*tail)->i_next;
+    *tail = in;
+    return in;
+}
+
+// --- message dispatch
+
+typedef void* (*t_newgimme)(t_symbol*, int, t_atom*);
+typedef void (*t_methgimme)(t_pd*, t_symbol*, int, t_atom*);
+
+static int host_collect(const t_atomtype* types, int ntypes, int argc, t_atom* argv,
+    t_float* f, t_symbol** s, int* nsym)
+{
+    int nf = 0;
+    *nsym = 0;
+
+    for (int i = 0; i < ntypes; i++) {
+        switch (types[i]) {
+        case A_FLOAT:
+        case A_DEFFLOAT:
+            assert(*nsym == 0);
+            f[nf++] = i < argc ? atom_getfloat(&argv[i]) : 0;
+            break;
+        case A_SYMBOL:
+        case A_DEFSYM:
+            assert(nf == 0 && *nsym == 0);
+            s[(*nsym)++] = i < argc ? atom_getsymbol(&argv[i]) : &s_;
+            break;
+        default:
+            assert(0 && "unsupported argument type");
+        }
+    }
+
+    return nf;
+}
+
+static void* host_callnew(t_class* c, int argc, t_atom* argv)
+{
+    if (c->c_nargs == 1 && c->c_args[0] == A_GIMME)
+        return ((t_newgimme)c->c_new)(c->c_name, argc, argv);
+
+    t_float f[HOST_MAXARGS];
+    t_symbol* s[1];
+    int nsym;
+    int nf = host_collect(c->c_args, c->c_nargs, argc, argv, f, s, &nsym);
+
+    if (nsym)
+        return ((void* (*)(t_symbol*))c->c_new)(s[0]);
+
+    switch (nf) {
+    case 0:
+        return ((void* (*)(void))c->c_new)();
+    case 1:
+        return ((void* (*)(t_floatarg))c->c_new)(f[0]);
+    case 2:
+        return ((void* (*)(t_floatarg, t_floatarg))c->c_new)(f[0], f[1]);
+    case 3:
+        return ((void* (*)(t_floatarg, t_floatarg, t_floatarg))c->c_new)(f[0], f[1], f[2]);
+    default:
+        assert(0 && "too many creation arguments");
+    }
+    return 0;
+}
+
+static void host_callmethod(t_pd* x, t_host_method* m, int argc, t_atom* argv)
+{
+    if (m->nargs == 1 && m->args[0] == A_GIMME) {
+        ((t_methgimme)m->fn)(x, m->sel, argc, argv);
+        return;
+    }
+
+    t_float f[HOST_MAXARGS];
+    t_symbol* s[1];
+    int nsym;
+    int nf = host_collect(m->args, m->nargs, argc, argv, f, s, &nsym);
+
+    if (nsym) {
+        ((void (*)(t_pd*, t_symbol*))m->fn)(x, s[0]);
+        return;
+    }
+
+    switch (nf) {
+    case 0:
+        ((void (*)(t_pd*))m->fn)(x);
+        break;
+    case 1:
+        ((void (*)(t_pd*, t_floatarg))m->fn)(x, f[0]);
+        break;
+    case 2:
+        ((void (*)(t_pd*, t_floatarg, t_floatarg))m->fn)(x, f[0], f[1]);
+        break;
+    case 3:
+        ((void (*)(t_pd*, t_floatarg, t_floatarg, t_floatarg))m->fn)(x, f[0], f[1], f[2]);
+        break;
+    default:
+        assert(0 && "too many method arguments");
+    }
+}
+
+// --- dsp
+
+void dsp_add(t_perfroutine f, int n, ...)
+{
+    assert(host_building && host_building->d_nchain < HOST_MAXCHAIN);
+
+    t_int* w = getbytes((n + 1) * sizeof(t_int));
+    w[0] = (t_int)f;
+
+    va_list ap;
+    va_start(ap, n);
+    for (int i = 0; i < n; i++)
+        w[i + 1] = va_arg(ap, t_int);
+    va_end(ap);
+
+    host_building->d_chain[host_building->d_nchain++] = w;
+}
+
+void signal_setmultiout(t_signal** sig, int nchans)
+{
+    assert(host_building && nchans > 0);
+
+    t_signal* s = *sig;
+    s->s_vec = realloc(s->s_vec, (size_t)s->s_n * nchans * sizeof(t_sample));
+    memset(s->s_vec, 0, (size_t)s->s_n * nchans * sizeof(t_sample));
+    s->s_nchans = nchans;
+}
+
+static t_host_dsp* host_finddsp(t_object* x)
+{
+    for (t_host_dsp* d = host_dsps; d; d = d->d_next) {
+        if (d->d_owner == x)
+            return d;
+    }
+    return 0;
+}
+
+static void host_freedsp(t_object* x)
+{
+    for (t_host_dsp** d = &host_dsps; *d; d = &(*d)->d_next) {
+        if ((*d)->d_owner != x)
+            continue;
+
+        t_host_dsp* old = *d;
+        *d = old->d_next;
+
+        for (int i = 0; i < old->d_nchain; i++)
+            free(old->d_chain[i]);
+        for (int i = 0; i < old->d_nin + old->d_nout; i++)
+            free(old->d_sig[i].s_vec);
+        free(old->d_sig);
+        free(old->d_sp);
+        free(old);
+        return;
+    }
+}
+
+int host_vecsize(t_object* x)
+{
+    t_host_dsp* d = host_finddsp(x);
+    return d ? d->d_n : 0;
+}
+
+int host_nsigin(t_object* x)
+{
+    int n = x->ob_pd->c_signalin >= 0;
+    for (t_inlet* in = x->te_inlet; in; in = in->i_next)
+        n += in->i_sym == &s_signal;
+    return n;
+}
+
+int host_nsigout(t_object* x)
+{
+    int n = 0;
+    for (t_outlet* o = x->te_outlet; o; o = o->o_next)
+        n += o->o_sym == &s_signal;
+    return n;
+}
+
+int host_dsp(t_object* x, int blocksize)
+{
+    t_host_method* m = host_findmethod(x->ob_pd, gensym("dsp"));
+    if (!m)
+        return -1;
+
+    host_freedsp(x);
+
+    t_host_dsp* d = calloc(1, sizeof(t_host_dsp));
+    d->d_owner = x;
+    d->d_n = blocksize;
+    d->d_nin = host_nsigin(x);
+    d->d_nout = host_nsigout(x);
+
+    int nsig = d->d_nin + d->d_nout;
+    d->d_sig = calloc(nsig ? nsig : 1, sizeof(t_signal));
+    d->d_sp = calloc(nsig ? nsig : 1, sizeof(t_signal*));
+
+    for (int i = 0; i < nsig; i++) {
+        d->d_sig[i].s_n = blocksize;
+        d->d_sig[i].s_vec = calloc(blocksize, sizeof(t_sample));
+        d->d_sig[i].s_sr = host_sr;
+        d->d_sig[i].s_nchans = 1;
+        d->d_sp[i] = &d->d_sig[i];
+    }
+
+    d->d_next = host_dsps;
+    host_dsps = d;
+
+    host_building = d;
+    ((void (*)(t_pd*, t_signal**))m->fn)(&x->ob_pd, d->d_sp);
+    host_building = 0;
+
+    return 0;
+}
+
+void host_tick(t_object* x)
+{
+    t_host_dsp* d = host_finddsp(x);
+    assert(d);
+
+    for (int i = 0; i < d->d_nchain; i++) {
+        t_int* w = d->d_chain[i];
+        (*(t_perfroutine)w[0])(w);
+    }
+}
+
+t_sample* host_in(t_object* x, int index)
+{
+    t_host_dsp* d = host_finddsp(x);
+    assert(d && index < d->d_nin);
+    return d->d_sig[index].s_vec;
+}
+
+t_sample* host_out(t_object* x, int index)
+{
+    t_host_dsp* d = host_finddsp(x);
+    assert(d && index < d->d_nout);
+    return d->d_sig[d->d_nin + index].s_vec;
+}
+
+int host_outchans(t_object* x, int index)
+{
+    t_host_dsp* d = host_finddsp(x);
+    assert(d && index < d->d_nout);
+    return d->d_sig[d->d_nin + index].s_nchans;
+}
+
+// --- system
+
+t_float sys_getsr(void)
+{
+    return host_sr;
+}
+
+int sys_getblksize(void)
+{
+    return host_blocksize;
+}
+
+void post(const char* fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(host_post, sizeof(host_post), fmt, ap);
+    va_end(ap);
+}
+
+void pd_error(const void* object, const char* fmt, ...)
+{
+    (void)object;
+
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(host_post, sizeof(host_post), fmt, ap);
+    va_end(ap);
+}
+
+const char* host_lastpost(void)
+{
+    return host_post;
+}
+
+int host_lastlist(const t_atom** argv)
+{
+    *argv = host_list;
+    return host_nlist;
+}
+
+// --- host interface
+
+void host_init(t_float samplerate, int blocksize)
+{
+    while (host_dsps)
+        host_freedsp(host_dsps->d_owner);
+
+    host_sr = samplerate;
+    host_blocksize = blocksize;
+    host_post[0] = 0;
+    host_nlist = 0;
+}
+
+void host_setsr(t_float samplerate)
+{
+    host_sr = samplerate;
+}
+
+t_object* host_new(const char* name, int argc, t_atom* argv)
+{
+    t_class* c = host_findclass(name);
+    if (!c || !c->c_new)
+        return 0;
+    return (t_object*)host_callnew(c, argc, argv);
+}
+
+t_object* host_bound(const char* name)
+{
+    return (t_object*)gensym(name)->s_thing;
+}
+
+void host_free(t_object* x)
+{
+    host_freedsp(x);
+    pd_free(&x->ob_pd);
+}
+
+int host_send(t_object* x, const char* sel, int argc, t_atom* argv)
+{
+    t_host_method* m = host_findmethod(x->ob_pd, gensym(sel));
+    if (!m && x->ob_pd->c_anything) {
+        ((t_methgimme)x->ob_pd->c_anything)(&x->ob_pd, gensym(sel), argc, argv);
+        return 0;
+    }
+    if (!m || (m->nargs == 1 && m->args[0] == A_CANT))
+        return -1;
+
+    host_callmethod(&x->ob_pd, m, argc, argv);
+    return 0;
+}
+
+int host_float(t_object* x, const char* sel, t_float f)
+{
+    t_atom a;
+    SETFLOAT(&a, f);
+    return host_send(x, sel, 1, &a);
+}
+
+int host_bang(t_object* x, const char* sel)
+{
+    return host_send(x, sel, 0, 0);
+}
+
+int host_sendlist(t_object* x, const char* messages)
+{
+    char buf[1024];
+    snprintf(buf, sizeof(buf), "%s", messages);
+
+    char* msg = buf;
+    while (msg) {
+        char* next = strchr(msg, ';');
+        if (next)
+            *next++ = 0;
+
+        char* tokens[HOST_MAXARGS + 1];
+        int ntokens = 0;
+        for (char* t = strtok(msg, " "); t && ntokens <= HOST_MAXARGS; t = strtok(0, " "))
+            tokens[ntokens++] = t;
+
+        if (ntokens) {
+            t_atom argv[HOST_MAXARGS];
+            for (int i = 1; i < ntokens; i++) {
+                char* end;
+                float f = strtof(tokens[i], &end);
+                if (*end)
+                    SETSYMBOL(&argv[i - 1], gensym(tokens[i]));
+                else
+                    SETFLOAT(&argv[i - 1], f);
+            }
+
+            if (host_send(x, tokens[0], ntokens - 1, argv))
+                return -1;
+        }
+
+        msg = next;
+    }
+
+    return 0;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "m_pd.h"
+
+// A fake Pd runtime for driving bruits objects outside of Pd
+//
+// Classes register themselves through their usual *_setup() function, get
+// instantiated by name, receive messages and run their dsp chain block by
+// block on buffers owned by the host. Only one object graph is modelled:
+// every object has its own private signal vectors and nothing is patched
+// together.
+
+#define HOST_MAXARGS 8
+
+// reset the runtime state (sample rate, block size) and drop all dsp chains
+void host_init(t_float samplerate, int blocksize);
+
+void host_setsr(t_float samplerate);
+
+// instantiate a registered class, as if typed into an object box
+t_object* host_new(const char* name, int argc, t_atom* argv);
+void host_free(t_object* x);
+
+// the object bound to a receive name, as in [; name message( it takes
+// messages through host_send() and host_sendlist()
+t_object* host_bound(const char* name);
+
+// send a message to the object's left inlet, returns 0 if it was understood
+// or taken by the class's anything method
+int host_send(t_object* x, const char* sel, int argc, t_atom* argv);
+int host_float(t_object* x, const char* sel, t_float f);
+int host_bang(t_object* x, const char* sel);
+
+// send messages written as in a message box, "pitch 2; integrator rk4"
+int host_sendlist(t_object* x, const char* messages);
+
+// (re)build the dsp chain of an object with the given block size
+int host_dsp(t_object* x, int blocksize);
+
+// run the dsp chain of an object for one block
+void host_tick(t_object* x);
+
+int host_vecsize(t_object* x);
+int host_nsigin(t_object* x);
+int host_nsigout(t_object* x);
+
+// outlet vectors of multichannel outlets hold the channels one after another
+t_sample* host_in(t_object* x, int index);
+t_sample* host_out(t_object* x, int index);
+int host_outchans(t_object* x, int index);
+
+// the last line written with post() or pd_error()
+const char* host_lastpost(void);
+
+// the atoms of the last list sent through any outlet, returns their count
+int host_lastlist(const t_atom** argv);
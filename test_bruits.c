@@ -1,9 +1,28 @@
 #include "unity/unity.h"
 
+#include "br_rand.h"
 #include "bruits.h"
+#include "pd_host.h"
+
+#include "mt19937ar/mt19937ar.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void ross_tilde_setup(void);
+void rossbank_tilde_setup(void);
+void lorenz_tilde_setup(void);
+void chua_tilde_setup(void);
+void thomas_tilde_setup(void);
+void aizawa_tilde_setup(void);
+void gendy_tilde_setup(void);
 
 void setUp(void)
 {
+    host_init(44100, 64);
 }
 
 void tearDown(void)
@@ -34,11 +53,1567 @@ void test_clamp(void)
     TEST_ASSERT_EQUAL_FLOAT(23, br_clamp(68, 0.1, 23.));
 }
 
-int main()
+void test_exp2(void)
+{
+    for (float x = -40; x < 40; x += 0.001f)
+        TEST_ASSERT_FLOAT_WITHIN(2e-7, 1, br_exp2(x) / exp2(x));
+
+    TEST_ASSERT_EQUAL_FLOAT(1, br_exp2(0));
+    TEST_ASSERT_EQUAL_FLOAT(0.25, br_exp2(-2));
+    TEST_ASSERT_EQUAL_FLOAT(exp2f(-125), br_exp2(-500));
+    TEST_ASSERT_EQUAL_FLOAT(exp2f(125), br_exp2(500));
+    TEST_ASSERT_FLOAT_WITHIN(2e-7, 1, br_exp2(-125) / exp2f(-125));
+}
+
+// --- objects
+
+static void render(t_object* x, int blocks, t_sample* dest)
+{
+    int n = host_vecsize(x);
+    for (int b = 0; b < blocks; b++) {
+        host_tick(x);
+        for (int i = 0; i < n; i++)
+            dest[b * n + i] = host_out(x, 0)[i];
+    }
+}
+
+void test_host_instantiates(void)
+{
+    t_object* ross = host_new("ross~", 0, 0);
+    t_object* gendy = host_new("gendy~", 0, 0);
+    TEST_ASSERT_NOT_NULL(ross);
+    TEST_ASSERT_NOT_NULL(gendy);
+    TEST_ASSERT_NULL(host_new("nope~", 0, 0));
+
+    TEST_ASSERT_EQUAL_INT(5, host_nsigin(ross));
+    TEST_ASSERT_EQUAL_INT(1, host_nsigout(ross));
+    TEST_ASSERT_EQUAL_INT(0, host_nsigin(gendy));
+    TEST_ASSERT_EQUAL_INT(1, host_nsigout(gendy));
+
+    host_free(ross);
+    host_free(gendy);
+}
+
+void test_host_messages(void)
+{
+    t_object* x = host_new("gendy~", 0, 0);
+
+    TEST_ASSERT_EQUAL_INT(0, host_float(x, "knum", 4));
+    TEST_ASSERT_EQUAL_INT(0, host_bang(x, "debug"));
+    TEST_ASSERT_EQUAL_STRING("breakpoints 0", host_lastpost());
+    TEST_ASSERT_EQUAL_INT(-1, host_bang(x, "nonsense"));
+
+    host_free(x);
+}
+
+void test_ross_output(void)
+{
+    t_object* x = host_new("ross~", 0, 0);
+    TEST_ASSERT_EQUAL_INT(0, host_dsp(x, 64));
+
+    static t_sample out[64 * 200];
+    render(x, 200, out);
+
+    // no input and mix 0.5: x is clamped to +-20 and scaled by 1/3
+    float peak = 0;
+    for (int i = 0; i < 64 * 200; i++) {
+        TEST_ASSERT_TRUE(isfinite(out[i]));
+        peak = br_maximum(peak, fabsf(out[i]));
+    }
+    TEST_ASSERT_TRUE(peak > 0.1f);
+    TEST_ASSERT_TRUE(peak <= 20.f / 3.f * 0.5f);
+
+    host_free(x);
+}
+
+void test_ross_mixes_input(void)
+{
+    t_object* x = host_new("ross~", 0, 0);
+    host_float(x, "mix", 1);
+    host_dsp(x, 64);
+
+    for (int i = 0; i < 64; i++)
+        host_in(x, 0)[i] = 0.25f;
+    host_tick(x);
+
+    for (int i = 0; i < 64; i++)
+        TEST_ASSERT_EQUAL_FLOAT(0.25f, host_out(x, 0)[i]);
+
+    host_free(x);
+}
+
+void test_ross_ignores_input_when_dry(void)
+{
+    t_object* a = host_new("ross~", 0, 0);
+    t_object* b = host_new("ross~", 0, 0);
+    host_float(a, "mix", 0);
+    host_float(b, "mix", 0);
+    host_dsp(a, 64);
+    host_dsp(b, 64);
+
+    for (int block = 0; block < 20; block++) {
+        for (int i = 0; i < 64; i++)
+            host_in(b, 0)[i] = (float)rand() / RAND_MAX - 0.5f;
+
+        host_tick(a);
+        host_tick(b);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(host_out(a, 0), host_out(b, 0), 64);
+    }
+
+    host_free(a);
+    host_free(b);
+}
+
+void test_ross_silent_input(void)
+{
+    // a silent input leaves the dry part of the mix, no matter the gain
+    t_object* silent = host_new("ross~", 0, 0);
+    t_object* dry = host_new("ross~", 0, 0);
+    host_sendlist(silent, "gain 2; mix 0.5");
+    host_sendlist(dry, "mix 0");
+    host_dsp(silent, 64);
+    host_dsp(dry, 64);
+
+    for (int b = 0; b < 20; b++) {
+        host_tick(silent);
+        host_tick(dry);
+        for (int i = 0; i < 64; i++)
+            TEST_ASSERT_EQUAL_FLOAT(host_out(dry, 0)[i] * 0.5f, host_out(silent, 0)[i]);
+    }
+
+    // a single sample is enough to mix the input in
+    host_in(silent, 0)[63] = 1;
+    host_tick(silent);
+    host_tick(dry);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, host_out(dry, 0)[0] * 0.5f, host_out(silent, 0)[0]);
+    TEST_ASSERT_TRUE(host_out(silent, 0)[63] > host_out(dry, 0)[63] * 0.5f + 0.4f);
+
+    host_free(silent);
+    host_free(dry);
+}
+
+void test_ross_follows_samplerate(void)
+{
+    t_object* a = host_new("ross~", 0, 0);
+    host_dsp(a, 64);
+    host_tick(a);
+    host_bang(a, "reset");
+
+    host_setsr(96000);
+    t_object* b = host_new("ross~", 0, 0);
+    host_dsp(a, 64);
+    host_dsp(b, 64);
+
+    for (int block = 0; block < 20; block++) {
+        host_tick(a);
+        host_tick(b);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(host_out(b, 0), host_out(a, 0), 64);
+    }
+
+    host_free(a);
+    host_free(b);
+}
+
+void test_ross_integrators_agree(void)
+{
+    // for a tiny step all integrators follow the same trajectory
+    const char* names[] = { "euler", "heun", "rk4", "semi", "dopri" };
+    float out[5][256];
+
+    for (int n = 0; n < 5; n++) {
+        t_object* x = host_new("ross~", 0, 0);
+        t_atom a;
+        SETSYMBOL(&a, gensym(names[n]));
+        TEST_ASSERT_EQUAL_INT(0, host_send(x, "integrator", 1, &a));
+        host_float(x, "pitch", -6);
+        host_float(x, "mix", 0);
+        host_dsp(x, 64);
+        render(x, 4, out[n]);
+        host_free(x);
+    }
+
+    for (int n = 0; n < 5; n++) {
+        for (int i = 0; i < 256; i++)
+            TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-3f, out[2][i], out[n][i], names[n]);
+        TEST_ASSERT_TRUE(fabsf(out[n][255] - out[n][0]) > 0.01f);
+    }
+}
+
+void test_ross_integrator_unknown(void)
+{
+    t_object* x = host_new("ross~", 0, 0);
+    t_atom a;
+    SETSYMBOL(&a, gensym("leapfrog"));
+    host_send(x, "integrator", 1, &a);
+    TEST_ASSERT_EQUAL_STRING("ross~: unknown integrator leapfrog (euler, heun, rk4, semi, dopri)", host_lastpost());
+    host_free(x);
+}
+
+void test_ross_dopri_high_pitch(void)
+{
+    // fixed steps this long leave the attractor and stick to the clamp, the
+    // adaptive integrator subdivides them and keeps oscillating
+    const char* names[] = { "rk4", "dopri" };
+    int clamped[2] = { 0, 0 };
+
+    for (int n = 0; n < 2; n++) {
+        t_object* x = host_new("ross~", 0, 0);
+        host_sendlist(x, "pitch 6; c 12; mix 0");
+        t_atom a;
+        SETSYMBOL(&a, gensym(names[n]));
+        host_send(x, "integrator", 1, &a);
+        host_dsp(x, 64);
+
+        for (int b = 0; b < 200; b++) {
+            host_tick(x);
+            for (int i = 0; i < 64; i++)
+                clamped[n] += fabsf(host_out(x, 0)[i]) >= 20.f / 3.f;
+        }
+        host_free(x);
+    }
+
+    TEST_ASSERT_TRUE(clamped[0] > 6400);
+    TEST_ASSERT_TRUE(clamped[1] < 640);
+}
+
+void test_ross_double(void)
+{
+    // at the lowest pitch a float step rounds away a good part of the change
+    // of the state, the double state follows an exact heun integration
+    t_atom a;
+    SETSYMBOL(&a, gensym("-double"));
+    t_object* objects[2] = { host_new("ross~", 0, 0), host_new("ross~", 1, &a) };
+
+    for (int n = 0; n < 2; n++) {
+        host_sendlist(objects[n], "pitch -10; mix 0");
+        host_dsp(objects[n], 64);
+    }
+
+    float h = 1.f / 44100.f * (261.6256f * powf(2.f, -10) * 6.2831853f);
+    double A = 0.2f, B = 0.2f, C = 5.7f;
+    double s[3] = { 0, 5, 0 };
+    float err[2] = { 0, 0 };
+
+    for (int b = 0; b < 200; b++) {
+        for (int n = 0; n < 2; n++)
+            host_tick(objects[n]);
+
+        for (int i = 0; i < 64; i++) {
+            double k1[3] = { -s[1] - s[2], s[0] + A * s[1], B + s[2] * (s[0] - C) };
+            double t[3];
+            for (int j = 0; j < 3; j++)
+                t[j] = s[j] + k1[j] * h * 0.5;
+            double k2[3] = { -t[1] - t[2], t[0] + A * t[1], B + t[2] * (t[0] - C) };
+            for (int j = 0; j < 3; j++)
+                s[j] += (k1[j] + k2[j]) * h * 0.5;
+
+            for (int n = 0; n < 2; n++)
+                err[n] = br_maximum(err[n], fabsf(host_out(objects[n], 0)[i] - (float)(s[0] / 3)));
+        }
+    }
+
+    TEST_ASSERT_TRUE(err[1] < 1e-6f);
+    TEST_ASSERT_TRUE(err[0] > 10 * err[1]);
+
+    for (int n = 0; n < 2; n++)
+        host_free(objects[n]);
+}
+
+void test_ross_pitch_inlet(void)
+{
+    // a constant inlet is added to the pitch message
+    t_object* message = host_new("ross~", 0, 0);
+    t_object* inlet = host_new("ross~", 0, 0);
+    host_float(message, "pitch", 1.5f);
+    host_float(inlet, "pitch", 1);
+    host_dsp(message, 64);
+    host_dsp(inlet, 64);
+
+    for (int b = 0; b < 8; b++) {
+        for (int i = 0; i < 64; i++)
+            host_in(inlet, 1)[i] = 0.5f;
+        host_tick(message);
+        host_tick(inlet);
+        for (int i = 0; i < 64; i++)
+            TEST_ASSERT_EQUAL_FLOAT(host_out(message, 0)[i], host_out(inlet, 0)[i]);
+    }
+
+    host_free(message);
+    host_free(inlet);
+
+    // with one sample blocks the inlet is always constant and takes the
+    // exact path, which the modulated one has to follow
+    t_object* fm = host_new("ross~", 0, 0);
+    t_object* exact = host_new("ross~", 0, 0);
+    host_dsp(fm, 64);
+    host_dsp(exact, 1);
+
+    for (int b = 0; b < 4; b++) {
+        for (int i = 0; i < 64; i++)
+            host_in(fm, 1)[i] = 2 * sinf((b * 64 + i) * 0.05f);
+        host_tick(fm);
+
+        for (int i = 0; i < 64; i++) {
+            host_in(exact, 1)[0] = host_in(fm, 1)[i];
+            host_tick(exact);
+            TEST_ASSERT_FLOAT_WITHIN(1e-4f, host_out(exact, 0)[0], host_out(fm, 0)[i]);
+        }
+    }
+
+    host_free(fm);
+    host_free(exact);
+}
+
+void test_ross_coefficient_inlets(void)
+{
+    // constant inlets are added to the messages
+    t_object* message = host_new("ross~", 0, 0);
+    t_object* inlet = host_new("ross~", 0, 0);
+    host_sendlist(message, "a 0.25; b 0.3; c 8.7");
+    host_sendlist(inlet, "a 0.1; b 0.4");
+    host_dsp(message, 64);
+    host_dsp(inlet, 64);
+
+    const float offsets[] = { 0.15f, -0.1f, 3 };
+    for (int b = 0; b < 8; b++) {
+        for (int j = 0; j < 3; j++) {
+            for (int i = 0; i < 64; i++)
+                host_in(inlet, 2 + j)[i] = offsets[j];
+        }
+        host_tick(message);
+        host_tick(inlet);
+        for (int i = 0; i < 64; i++)
+            TEST_ASSERT_FLOAT_WITHIN(1e-6f, host_out(message, 0)[i], host_out(inlet, 0)[i]);
+    }
+
+    host_free(message);
+    host_free(inlet);
+
+    // a modulated block follows the constant one sample blocks
+    const char* integrators[] = { "integrator heun", "integrator rk4" };
+    for (int n = 0; n < 2; n++) {
+        t_object* mod = host_new("ross~", 0, 0);
+        t_object* exact = host_new("ross~", 0, 0);
+        host_sendlist(mod, integrators[n]);
+        host_sendlist(exact, integrators[n]);
+        host_dsp(mod, 64);
+        host_dsp(exact, 1);
+
+        for (int b = 0; b < 4; b++) {
+            for (int i = 0; i < 64; i++) {
+                float t = (b * 64 + i) * 0.03f;
+                host_in(mod, 2)[i] = 0.1f * sinf(t);
+                host_in(mod, 3)[i] = 0.1f * cosf(t);
+                host_in(mod, 4)[i] = 4 * sinf(t * 0.5f);
+            }
+            host_tick(mod);
+
+            for (int i = 0; i < 64; i++) {
+                for (int j = 2; j < 5; j++)
+                    host_in(exact, j)[0] = host_in(mod, j)[i];
+                host_tick(exact);
+                TEST_ASSERT_EQUAL_FLOAT(host_out(exact, 0)[0], host_out(mod, 0)[i]);
+            }
+        }
+
+        host_free(mod);
+        host_free(exact);
+    }
+}
+
+static t_object* ross_new_flag(const char* flag)
+{
+    t_atom a;
+    SETSYMBOL(&a, gensym(flag));
+    return host_new("ross~", 1, &a);
+}
+
+void test_ross_ramp(void)
+{
+    // with gain 0 the mix doesn't change the state, a ramped mix matches
+    // one that is set to the ramp's value at every block
+    t_object* ramped = host_new("ross~", 0, 0);
+    t_object* stepped = host_new("ross~", 0, 0);
+
+    // before dsp the parameters are set right away
+    host_sendlist(ramped, "ramp 10; pitch 1");
+    host_sendlist(stepped, "pitch 1");
+    host_dsp(ramped, 64);
+    host_dsp(stepped, 64);
+
+    // 10 ms are 441 samples, in 7 blocks
+    host_float(ramped, "mix", 1);
+
+    for (int b = 0; b < 10; b++) {
+        for (int i = 0; i < 64; i++) {
+            host_in(ramped, 0)[i] = 0.25f;
+            host_in(stepped, 0)[i] = 0.25f;
+        }
+
+        host_float(stepped, "mix", b < 6 ? 0.5f + (b + 1) * 0.5f / 7 : 1.f);
+        host_tick(ramped);
+        host_tick(stepped);
+
+        for (int i = 0; i < 64; i++)
+            TEST_ASSERT_FLOAT_WITHIN(1e-6f, host_out(stepped, 0)[i], host_out(ramped, 0)[i]);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(0.25f, host_out(ramped, 0)[63]);
+
+    // reset ends the ramp
+    host_float(ramped, "mix", 0);
+    host_bang(ramped, "reset");
+    host_bang(stepped, "reset");
+    host_tick(ramped);
+    host_tick(stepped);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(host_out(stepped, 0), host_out(ramped, 0), 64);
+
+    host_free(ramped);
+    host_free(stepped);
+}
+
+void test_ross_cache(void)
+{
+    // a window of 0.1 s after settling for 0.1 s, which is 4410 samples
+    // with a crossfade over the last 1102
+    t_object* cached = host_new("ross~", 0, 0);
+    t_object* live = host_new("ross~", 0, 0);
+    host_sendlist(cached, "cache 0.1 0.1; mix 0");
+    host_sendlist(live, "mix 0");
+    host_dsp(cached, 64);
+    host_dsp(live, 64);
+
+    static t_sample out[64 * 300];
+    for (int b = 0; b < 300; b++) {
+        host_tick(cached);
+        host_tick(live);
+        memcpy(out + b * 64, host_out(cached, 0), 64 * sizeof(t_sample));
+
+        // settling and recording integrate until the crossfade
+        if (b < 120) {
+            for (int i = 0; i < 64; i++)
+                TEST_ASSERT_EQUAL_FLOAT(host_out(live, 0)[i], out[b * 64 + i]);
+        }
+    }
+
+    // then the window loops without the start of the crossfade
+    int settle = 69 * 64;
+    int loop = 4410 - 1102;
+    for (int i = settle + 4410; i < 64 * 300 - loop; i++)
+        TEST_ASSERT_EQUAL_FLOAT(out[i], out[i + loop]);
+
+    // the loop goes on without a jump, no step is larger than in the window
+    float slew = 0;
+    for (int i = settle + 1; i < settle + 4410; i++)
+        slew = br_maximum(slew, fabsf(out[i] - out[i - 1]));
+    for (int i = settle + 4410; i < 64 * 300; i++)
+        TEST_ASSERT_TRUE(fabsf(out[i] - out[i - 1]) < 1.5f * slew);
+
+    // a parameter change integrates from the looped state again
+    t_object* copy = host_new("ross~", 0, 0);
+    host_sendlist(copy, "cache 0.1 0.1; mix 0");
+    host_dsp(copy, 64);
+    for (int b = 0; b < 300; b++)
+        host_tick(copy);
+
+    host_float(cached, "c", 6);
+    host_tick(cached);
+    host_tick(copy);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, host_out(copy, 0)[0], host_out(cached, 0)[0]);
+    TEST_ASSERT_TRUE(fabsf(host_out(copy, 0)[63] - host_out(cached, 0)[63]) > 1e-5f);
+
+    // and reset starts over from the initial state
+    host_bang(cached, "reset");
+    host_bang(live, "reset");
+    host_sendlist(cached, "mix 0");
+    host_sendlist(live, "mix 0");
+    for (int b = 0; b < 20; b++) {
+        host_tick(cached);
+        host_tick(live);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(host_out(live, 0), host_out(cached, 0), 64);
+    }
+
+    host_free(cached);
+    host_free(live);
+    host_free(copy);
+}
+
+static void ross_stats(t_object* x, int* clamps, int* diverged, int* resets)
+{
+    host_bang(x, "stats");
+    TEST_ASSERT_EQUAL_INT(3, sscanf(host_lastpost(), "ross~: %d samples clamped, %d blocks diverged, %d resets",
+                                 clamps, diverged, resets));
+}
+
+void test_ross_stats(void)
+{
+    int clamps, diverged, resets;
+
+    // the default trajectory touches the clamp now and then
+    t_object* x = host_new("ross~", 0, 0);
+    host_dsp(x, 64);
+    for (int b = 0; b < 200; b++)
+        host_tick(x);
+
+    ross_stats(x, &clamps, &diverged, &resets);
+    TEST_ASSERT_TRUE(clamps > 0 && clamps < 64 * 200);
+    TEST_ASSERT_EQUAL_INT(0, diverged);
+    ross_stats(x, &clamps, &diverged, &resets);
+    TEST_ASSERT_EQUAL_INT(0, clamps);
+
+    // steps this long stick to the clamp, which stays finite and so isn't
+    // counted as divergence
+    host_sendlist(x, "pitch 6; c 12; integrator rk4; autoreset 1");
+    for (int b = 0; b < 200; b++)
+        host_tick(x);
+
+    ross_stats(x, &clamps, &diverged, &resets);
+    TEST_ASSERT_TRUE(clamps > 64 * 100);
+    TEST_ASSERT_EQUAL_INT(0, diverged);
+    TEST_ASSERT_EQUAL_INT(0, resets);
+
+    host_free(x);
+}
+
+void test_ross_autoreset(void)
+{
+    int clamps, diverged, resets;
+
+    // a NaN on the input spoils the state, in a block with other input as
+    // -ffast-math lets the silence check take a NaN for zero
+    t_object* kept = host_new("ross~", 0, 0);
+    t_object* reset = host_new("ross~", 0, 0);
+    host_sendlist(kept, "gain 1");
+    host_sendlist(reset, "gain 1; autoreset 1");
+    host_dsp(kept, 64);
+    host_dsp(reset, 64);
+
+    host_in(kept, 0)[5] = 0.5f;
+    host_in(reset, 0)[5] = 0.5f;
+    host_in(kept, 0)[10] = NAN;
+    host_in(reset, 0)[10] = NAN;
+    host_tick(kept);
+    host_tick(reset);
+    host_in(kept, 0)[5] = 0;
+    host_in(reset, 0)[5] = 0;
+    host_in(kept, 0)[10] = 0;
+    host_in(reset, 0)[10] = 0;
+
+    for (int b = 0; b < 10; b++) {
+        host_tick(kept);
+        host_tick(reset);
+    }
+    // br_finite() as -ffast-math folds isfinite() to true
+    TEST_ASSERT_TRUE(br_finite(host_out(reset, 0)[63]));
+
+    // without -ffast-math the NaN stays in the state, with it the clamp
+    // turns it into a bound, either way the block it came in diverged
+    ross_stats(kept, &clamps, &diverged, &resets);
+    TEST_ASSERT_TRUE(diverged >= 1);
+    TEST_ASSERT_EQUAL_INT(0, resets);
+    ross_stats(reset, &clamps, &diverged, &resets);
+    TEST_ASSERT_EQUAL_INT(1, diverged);
+    TEST_ASSERT_EQUAL_INT(1, resets);
+
+    host_free(kept);
+    host_free(reset);
+}
+
+// the list the state message outputs
+static void ross_state(t_object* x, t_atom* s)
+{
+    const t_atom* list;
+    host_bang(x, "state");
+    TEST_ASSERT_EQUAL_INT(3, host_lastlist(&list));
+    memcpy(s, list, 3 * sizeof(t_atom));
+}
+
+void test_ross_state_restore(void)
+{
+    t_atom s[3];
+
+    // a restored state continues the trajectory it was taken from, the
+    // output of state goes into restore as it is
+    t_object* a = host_new("ross~", 0, 0);
+    t_object* b = host_new("ross~", 0, 0);
+    host_dsp(a, 64);
+    host_dsp(b, 64);
+    for (int i = 0; i < 50; i++)
+        host_tick(a);
+
+    ross_state(a, s);
+    TEST_ASSERT_EQUAL_INT(0, host_send(b, "restore", 3, s));
+    for (int i = 0; i < 20; i++) {
+        host_tick(a);
+        host_tick(b);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(host_out(a, 0), host_out(b, 0), 64);
+    }
+
+    // an instance with -double continues from its state rounded to float
+    t_atom flag;
+    SETSYMBOL(&flag, gensym("-double"));
+    t_object* c = host_new("ross~", 1, &flag);
+    host_dsp(c, 64);
+    host_send(b, "restore", 3, s);
+    host_send(c, "restore", 3, s);
+    host_tick(b);
+    host_tick(c);
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, host_out(b, 0)[63], host_out(c, 0)[63]);
+    host_free(c);
+
+    host_sendlist(b, "restore 1 2");
+    TEST_ASSERT_EQUAL_STRING("ross~: restore expects x, y and z", host_lastpost());
+
+    host_free(a);
+    host_free(b);
+}
+
+void test_ross_initial_state(void)
+{
+    t_atom s[3];
+    t_atom argv[4];
+    SETFLOAT(argv, 1);
+    SETFLOAT(argv + 1, 2);
+    SETFLOAT(argv + 2, 30);
+
+    // creation arguments set the state, within the clamp, and reset returns to it
+    t_object* x = host_new("ross~", 3, argv);
+    ross_state(x, s);
+    TEST_ASSERT_EQUAL_FLOAT(1, atom_getfloat(s));
+    TEST_ASSERT_EQUAL_FLOAT(2, atom_getfloat(s + 1));
+    TEST_ASSERT_EQUAL_FLOAT(20, atom_getfloat(s + 2));
+
+    host_dsp(x, 64);
+    host_tick(x);
+    host_bang(x, "reset");
+    ross_state(x, s);
+    TEST_ASSERT_EQUAL_FLOAT(1, atom_getfloat(s));
+    TEST_ASSERT_EQUAL_FLOAT(20, atom_getfloat(s + 2));
+    host_free(x);
+
+    // flags mix with the values, a fourth value is an error
+    SETSYMBOL(argv, gensym("-double"));
+    SETFLOAT(argv + 1, 1);
+    SETFLOAT(argv + 2, 2);
+    SETFLOAT(argv + 3, 3);
+    x = host_new("ross~", 4, argv);
+    ross_state(x, s);
+    TEST_ASSERT_EQUAL_FLOAT(3, atom_getfloat(s + 2));
+    host_free(x);
+
+    SETFLOAT(argv, 4);
+    x = host_new("ross~", 4, argv);
+    TEST_ASSERT_EQUAL_STRING("ross~: extra initial value 3, expects x y z", host_lastpost());
+    host_free(x);
+}
+
+void test_ross_yz_outlets(void)
+{
+    const char* integrators[] = { "integrator heun", "integrator dopri; gain 1" };
+
+    for (int n = 0; n < 2; n++) {
+        t_object* plain = host_new("ross~", 0, 0);
+        t_object* yz = ross_new_flag("-yz");
+        t_object* norm = ross_new_flag("-norm");
+        TEST_ASSERT_EQUAL_INT(1, host_nsigout(plain));
+        TEST_ASSERT_EQUAL_INT(3, host_nsigout(yz));
+        TEST_ASSERT_EQUAL_INT(3, host_nsigout(norm));
+
+        t_object* all[] = { plain, yz, norm };
+        for (int i = 0; i < 3; i++) {
+            host_sendlist(all[i], integrators[n]);
+            host_dsp(all[i], 64);
+            for (int j = 0; j < 64; j++)
+                host_in(all[i], 0)[j] = sinf(j * 0.1f);
+        }
+
+        float zpeak = 0;
+        for (int b = 0; b < 50; b++) {
+            for (int i = 0; i < 3; i++)
+                host_tick(all[i]);
+
+            for (int i = 0; i < 64; i++) {
+                // the same integration serves all outlets
+                TEST_ASSERT_EQUAL_FLOAT(host_out(plain, 0)[i], host_out(yz, 0)[i]);
+                TEST_ASSERT_EQUAL_FLOAT(host_out(plain, 0)[i], host_out(norm, 0)[i]);
+                TEST_ASSERT_FLOAT_WITHIN(1e-5f, host_out(yz, 1)[i] * 3, host_out(norm, 1)[i] * 20);
+                TEST_ASSERT_FLOAT_WITHIN(1e-5f, host_out(yz, 2)[i] * 3, host_out(norm, 2)[i] * 20);
+                TEST_ASSERT_TRUE(fabsf(host_out(norm, 1)[i]) <= 1.f);
+                TEST_ASSERT_TRUE(fabsf(host_out(norm, 2)[i]) <= 1.f);
+                zpeak = br_maximum(zpeak, host_out(norm, 2)[i]);
+            }
+        }
+        TEST_ASSERT_TRUE(zpeak > 0.05f);
+
+        for (int i = 0; i < 3; i++)
+            host_free(all[i]);
+    }
+}
+
+void test_ross_unknown_argument(void)
+{
+    t_object* x = ross_new_flag("-xyz");
+    TEST_ASSERT_NOT_NULL(x);
+    TEST_ASSERT_EQUAL_STRING("ross~: unknown argument -xyz (-yz, -norm, -double)", host_lastpost());
+    TEST_ASSERT_EQUAL_INT(1, host_nsigout(x));
+    host_free(x);
+}
+
+static t_object* rossbank_new(int voices, bool multichannel)
+{
+    t_atom argv[2];
+    SETSYMBOL(&argv[0], gensym("-mc"));
+    SETFLOAT(&argv[1], voices);
+    return multichannel ? host_new("rossbank~", 2, argv) : host_new("rossbank~", 1, argv + 1);
+}
+
+void test_rossbank_arguments(void)
+{
+    // a mistyped flag is an error rather than a count of voices
+    t_atom argv[2];
+    SETSYMBOL(&argv[0], gensym("-mcc"));
+    SETFLOAT(&argv[1], 3);
+    t_object* x = host_new("rossbank~", 2, argv);
+    TEST_ASSERT_NOT_NULL(x);
+    TEST_ASSERT_EQUAL_STRING("rossbank~: unknown argument -mcc (-mc)", host_lastpost());
+    // and the count after it still makes three voices
+    host_sendlist(x, "pitch 2 1");
+    TEST_ASSERT_EQUAL_STRING("rossbank~: unknown argument -mcc (-mc)", host_lastpost());
+    host_free(x);
+
+    // the number of voices is clamped with a message
+    x = rossbank_new(0, true);
+    TEST_ASSERT_EQUAL_STRING("rossbank~: voices expects 1 to 1024, using 1", host_lastpost());
+    host_dsp(x, 64);
+    TEST_ASSERT_EQUAL_INT(1, host_outchans(x, 0));
+    host_free(x);
+
+    x = rossbank_new(5000, true);
+    TEST_ASSERT_EQUAL_STRING("rossbank~: voices expects 1 to 1024, using 1024", host_lastpost());
+    host_dsp(x, 64);
+    TEST_ASSERT_EQUAL_INT(1024, host_outchans(x, 0));
+    host_free(x);
+}
+
+// each voice is a ross~ without input
+static const char* rossbank_voices[] = { "", "pitch 1", "a 0.3; c 8" };
+
+void test_rossbank_matches_ross(void)
+{
+    t_object* bank = rossbank_new(3, true);
+    TEST_ASSERT_NOT_NULL(bank);
+    TEST_ASSERT_EQUAL_INT(0, host_nsigin(bank));
+    TEST_ASSERT_EQUAL_INT(0, host_sendlist(bank, "pitch 1 1; a 2 0.3; c 2 8"));
+    host_dsp(bank, 64);
+    TEST_ASSERT_EQUAL_INT(3, host_outchans(bank, 0));
+
+    t_object* voices[3];
+    for (int v = 0; v < 3; v++) {
+        voices[v] = host_new("ross~", 0, 0);
+        host_sendlist(voices[v], rossbank_voices[v]);
+        host_float(voices[v], "mix", 0);
+        host_dsp(voices[v], 64);
+    }
+
+    // the bank's loop over the voices is vectorized and rounds differently
+    // under -ffast-math, by up to 8e-6 over these blocks
+    for (int b = 0; b < 8; b++) {
+        host_tick(bank);
+        for (int v = 0; v < 3; v++) {
+            host_tick(voices[v]);
+            for (int i = 0; i < 64; i++)
+                TEST_ASSERT_FLOAT_WITHIN_MESSAGE(2e-5f, host_out(voices[v], 0)[i], host_out(bank, 0)[v * 64 + i], rossbank_voices[v]);
+        }
+    }
+
+    for (int v = 0; v < 3; v++)
+        host_free(voices[v]);
+    host_free(bank);
+}
+
+void test_rossbank_sums_voices(void)
+{
+    // the sum is at the level of a single voice, and more voices than a group
+    t_object* mc = rossbank_new(11, true);
+    t_object* sum = rossbank_new(11, false);
+
+    for (int v = 0; v < 11; v++) {
+        t_atom argv[2];
+        SETFLOAT(&argv[0], v);
+        SETFLOAT(&argv[1], v * 0.1f);
+        host_send(mc, "pitch", 2, argv);
+        host_send(sum, "pitch", 2, argv);
+    }
+
+    host_dsp(mc, 64);
+    host_dsp(sum, 64);
+    TEST_ASSERT_EQUAL_INT(11, host_outchans(mc, 0));
+    TEST_ASSERT_EQUAL_INT(1, host_outchans(sum, 0));
+
+    for (int b = 0; b < 4; b++) {
+        host_tick(mc);
+        host_tick(sum);
+        for (int i = 0; i < 64; i++) {
+            float mean = 0;
+            for (int v = 0; v < 11; v++)
+                mean += host_out(mc, 0)[v * 64 + i] / 11;
+            TEST_ASSERT_FLOAT_WITHIN(1e-5f, mean, host_out(sum, 0)[i]);
+        }
+    }
+
+    host_free(mc);
+    host_free(sum);
+}
+
+void test_rossbank_couples_voices(void)
+{
+    // voice 1 is driven by voice 0 as a ross~ whose input is the x of voice 0
+    // one sample earlier, voice 0 is left alone
+    t_object* bank = rossbank_new(2, true);
+    host_sendlist(bank, "c 1 8; couple 1 0 0.5");
+    host_dsp(bank, 64);
+
+    t_object* alone = host_new("ross~", 0, 0);
+    t_object* driven = host_new("ross~", 0, 0);
+    host_sendlist(alone, "mix 0");
+    host_sendlist(driven, "c 8; mix 0; gain 0.5");
+    host_dsp(alone, 64);
+    host_dsp(driven, 64);
+
+    float last = 0;
+    for (int b = 0; b < 8; b++) {
+        host_tick(bank);
+        for (int i = 0; i < 64; i++) {
+            host_in(driven, 0)[i] = last;
+            last = host_out(bank, 0)[i] * 3;
+        }
+        host_tick(alone);
+        host_tick(driven);
+
+        for (int i = 0; i < 64; i++) {
+            TEST_ASSERT_FLOAT_WITHIN(1e-5f, host_out(alone, 0)[i], host_out(bank, 0)[i]);
+            TEST_ASSERT_FLOAT_WITHIN(1e-4f, host_out(driven, 0)[i], host_out(bank, 0)[64 + i]);
+        }
+    }
+
+    // reset drops the coupling
+    host_bang(bank, "reset");
+    host_sendlist(driven, "reset; mix 0");
+    host_tick(bank);
+    host_tick(driven);
+    for (int i = 0; i < 64; i++)
+        TEST_ASSERT_FLOAT_WITHIN(1e-6f, host_out(driven, 0)[i], host_out(bank, 0)[64 + i]);
+
+    host_free(alone);
+    host_free(driven);
+    host_free(bank);
+}
+
+void test_rossbank_messages(void)
 {
+    t_object* x = rossbank_new(3, false);
+
+    host_sendlist(x, "c 3 8");
+    TEST_ASSERT_EQUAL_STRING("rossbank~: no voice 3", host_lastpost());
+    host_sendlist(x, "pitch");
+    TEST_ASSERT_EQUAL_STRING("rossbank~: pitch expects a value or a voice and a value", host_lastpost());
+    host_sendlist(x, "couple 0 3 1");
+    TEST_ASSERT_EQUAL_STRING("rossbank~: no voices 0 and 3", host_lastpost());
+    host_sendlist(x, "couple 0 1");
+    TEST_ASSERT_EQUAL_STRING("rossbank~: couple expects a weight or two voices and a weight", host_lastpost());
+
+    host_free(x);
+}
+
+static const char* attractors[] = { "lorenz~", "chua~", "thomas~", "aizawa~" };
+
+void test_attractors_output(void)
+{
+    for (int n = 0; n < 4; n++) {
+        t_object* x = host_new(attractors[n], 0, 0);
+        TEST_ASSERT_NOT_NULL(x);
+        TEST_ASSERT_EQUAL_INT(1, host_nsigin(x));
+        TEST_ASSERT_EQUAL_INT(1, host_nsigout(x));
+        host_float(x, "mix", 0);
+        host_dsp(x, 64);
+
+        // scaled to about +-1 and oscillating at pitch 0
+        static t_sample out[64 * 400];
+        render(x, 400, out);
+
+        float peak = 0;
+        int crossings = 0;
+        for (int i = 0; i < 64 * 400; i++) {
+            TEST_ASSERT_TRUE_MESSAGE(isfinite(out[i]), attractors[n]);
+            peak = br_maximum(peak, fabsf(out[i]));
+            crossings += i > 0 && (out[i] > 0) != (out[i - 1] > 0);
+        }
+        TEST_ASSERT_TRUE_MESSAGE(peak > 0.3f && peak < 2.f, attractors[n]);
+        TEST_ASSERT_TRUE_MESSAGE(crossings > 20, attractors[n]);
+
+        host_free(x);
+    }
+}
+
+void test_attractors_integrators_agree(void)
+{
+    // the integrators are shared, for a tiny step they all agree
+    const char* names[] = { "euler", "heun", "rk4" };
+
+    for (int n = 0; n < 4; n++) {
+        float out[3][256];
+        for (int k = 0; k < 3; k++) {
+            t_object* x = host_new(attractors[n], 0, 0);
+            t_atom a;
+            SETSYMBOL(&a, gensym(names[k]));
+            TEST_ASSERT_EQUAL_INT(0, host_send(x, "integrator", 1, &a));
+            host_sendlist(x, "pitch -6; mix 0");
+            host_dsp(x, 64);
+            render(x, 4, out[k]);
+            host_free(x);
+        }
+
+        for (int k = 0; k < 3; k++) {
+            for (int i = 0; i < 256; i++)
+                TEST_ASSERT_FLOAT_WITHIN_MESSAGE(1e-3f, out[2][i], out[k][i], attractors[n]);
+        }
+        TEST_ASSERT_TRUE_MESSAGE(fabsf(out[2][255] - out[2][0]) > 1e-3f, attractors[n]);
+    }
+}
+
+void test_attractor_params(void)
+{
+    t_object* x = host_new("lorenz~", 0, 0);
+
+    // below rho 1 the origin attracts
+    TEST_ASSERT_EQUAL_INT(0, host_sendlist(x, "rho 0.5; mix 0"));
+    host_dsp(x, 64);
+    for (int b = 0; b < 200; b++)
+        host_tick(x);
+    TEST_ASSERT_FLOAT_WITHIN(1e-3f, 0, host_out(x, 0)[63]);
+
+    host_bang(x, "nonsense");
+    TEST_ASSERT_EQUAL_STRING("lorenz~: no method for 'nonsense'", host_lastpost());
+
+    t_atom a;
+    SETSYMBOL(&a, gensym("dopri"));
+    host_send(x, "integrator", 1, &a);
+    TEST_ASSERT_EQUAL_STRING("lorenz~: unknown integrator dopri (euler, heun, rk4)", host_lastpost());
+
+    host_free(x);
+}
+
+void test_mt_state(void)
+{
+    // the reference output of mt19937ar for its default seed
+    mt_state a, b;
+    mt_init(&a, 5489);
+    TEST_ASSERT_EQUAL_UINT32(3499211612UL, mt_genrand_int32(&a));
+
+    // interleaved states don't disturb each other or the shared one
+    mt_init(&a, 1);
+    mt_init(&b, 2);
+    init_genrand(1);
+    for (int i = 0; i < 2000; i++) {
+        mt_genrand_int32(&b);
+        TEST_ASSERT_EQUAL_UINT32(genrand_int32(), mt_genrand_int32(&a));
+    }
+
+    // the bulk fill continues the same stream across the table's refills
+    static double bulk[3000];
+    mt_init(&a, 3);
+    mt_init(&b, 3);
+    mt_genrand_real1(&a);
+    mt_genrand_real1(&b);
+    mt_fill_real1(&b, bulk, 100);
+    mt_fill_real1(&b, bulk + 100, 2900);
+    for (int i = 0; i < 3000; i++)
+        TEST_ASSERT_TRUE(bulk[i] == mt_genrand_real1(&a));
+}
+
+// Statistical smoke tests of a generator on [0,1]: mean, variance, a
+// chi-square over 16 bins and the correlation of neighbours, all with
+// margins of about five standard errors.
+static void rand_smoke(const char* name, double (*next)(void*), void* state)
+{
+    enum { n = 1 << 16, bins = 16 };
+    int hist[bins] = { 0 };
+    double sum = 0, sumsq = 0, lag = 0, prev = next(state);
+
+    for (int i = 0; i < n; i++) {
+        double u = next(state);
+        TEST_ASSERT_TRUE_MESSAGE(u >= 0 && u <= 1, name);
+
+        sum += u;
+        sumsq += u * u;
+        lag += (u - 0.5) * (prev - 0.5);
+        hist[br_minimum((int)(u * bins), bins - 1)]++;
+        prev = u;
+    }
+
+    double mean = sum / n;
+    double var = sumsq / n - mean * mean;
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.006, 0.5, (float)mean, name);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.0015, 1 / 12.f, (float)var, name);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(0.02, 0, (float)(lag / n * 12), name);
+
+    // the 99.9% quantile for 15 degrees of freedom is 37.7
+    double chi = 0, expected = (double)n / bins;
+    for (int b = 0; b < bins; b++)
+        chi += (hist[b] - expected) * (hist[b] - expected) / expected;
+    TEST_ASSERT_TRUE_MESSAGE(chi < 37.7, name);
+}
+
+static double rand_xoshiro(void* r)
+{
+    return br_xoshiro_uniform(r);
+}
+
+static double rand_pcg32(void* r)
+{
+    return br_pcg32_uniform(r);
+}
+
+static double rand_mt(void* r)
+{
+    return mt_genrand_real1(r);
+}
+
+static double rand_philox(void* r)
+{
+    return br_philox_uniform(r);
+}
+
+static double rand_selected(void* r)
+{
+    return br_rand_uniform(r);
+}
+
+void test_rand(void)
+{
+    // the reference output of pcg32-global-demo, seeded with 42 and 54
+    static const uint32_t pcg32_reference[] = { 0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293,
+        0xbfa4784b, 0xcbed606e };
+    t_br_pcg32 pcg;
+    br_pcg32_seed(&pcg, 42, 54);
+    for (int i = 0; i < 6; i++)
+        TEST_ASSERT_EQUAL_HEX32(pcg32_reference[i], br_pcg32_next(&pcg));
+
+    t_br_xoshiro xoshiro;
+    br_xoshiro_seed(&xoshiro, 1);
+    rand_smoke("xoshiro256+", rand_xoshiro, &xoshiro);
+    br_pcg32_seed(&pcg, 1, 1);
+    rand_smoke("pcg32", rand_pcg32, &pcg);
+    static mt_state mt;
+    mt_init(&mt, 1);
+    rand_smoke("mt19937", rand_mt, &mt);
+    t_br_philox philox;
+    br_philox_seed(&philox, 1, 0);
+    rand_smoke("philox4x32", rand_philox, &philox);
+
+    // the fill continues the numbers of the selected generator
+    static t_br_rand a, b;
+    double bulk[100];
+    br_rand_seed(&a, 2);
+    br_rand_seed(&b, 2);
+    br_rand_fill(&b, bulk, 100);
+    for (int i = 0; i < 100; i++)
+        TEST_ASSERT_TRUE(bulk[i] == br_rand_uniform(&a));
+    rand_smoke("br_rand", rand_selected, &a);
+
+    // seeds that differ in one bit give unrelated streams
+    br_rand_seed(&a, 2);
+    br_rand_seed(&b, 3);
+    int same = 0;
+    for (int i = 0; i < 100; i++)
+        same += br_rand_uniform(&a) == br_rand_uniform(&b);
+    TEST_ASSERT_EQUAL_INT(0, same);
+}
+
+static void seed_xoshiro(void* r, uint64_t seed)
+{
+    br_xoshiro_seed(r, seed);
+}
+
+static void seed_pcg32(void* r, uint64_t seed)
+{
+    br_pcg32_seed(r, seed, 1);
+}
+
+static void seed_mt(void* r, uint64_t seed)
+{
+    mt_init(r, (unsigned long)seed);
+}
+
+static void seed_philox(void* r, uint64_t seed)
+{
+    br_philox_seed(r, seed, 0);
+}
+
+void test_rand_seeds(void)
+{
+    // every generator gives the same numbers for a seed and others for the
+    // next seed, whichever one gendy~ is built with
+    static const struct {
+        const char* name;
+        void (*seed)(void*, uint64_t);
+        double (*uniform)(void*);
+    } generators[] = {
+        { "xoshiro256+", seed_xoshiro, rand_xoshiro },
+        { "pcg32", seed_pcg32, rand_pcg32 },
+        { "mt19937", seed_mt, rand_mt },
+        { "philox4x32", seed_philox, rand_philox },
+    };
+    static union {
+        t_br_xoshiro xoshiro;
+        t_br_pcg32 pcg32;
+        mt_state mt;
+        t_br_philox philox;
+    } state[3];
+
+    for (int g = 0; g < 4; g++) {
+        double first[100];
+        int same = 0;
+        generators[g].seed(&state[0], 1234);
+        generators[g].seed(&state[1], 1234);
+        generators[g].seed(&state[2], 1235);
+        for (int i = 0; i < 100; i++) {
+            first[i] = generators[g].uniform(&state[0]);
+            TEST_ASSERT_TRUE_MESSAGE(first[i] == generators[g].uniform(&state[1]), generators[g].name);
+            same += first[i] == generators[g].uniform(&state[2]);
+        }
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, same, generators[g].name);
+    }
+
+    // the first numbers of the selected generator for seed 1, the gendy~
+    // golden entries only cover the default one
+#if defined(BR_RAND_MT)
+    static const double expected[] = { 0.41702199853421701, 0.99718480836534518, 0.72032448945574568,
+        0.93255736141757983 };
+#elif defined(BR_RAND_PHILOX)
+    static const double expected[] = { 0.89025917297468038, 0.8946847163361229, 0.58572594835090586,
+        0.71126807660592439 };
+#elif defined(BR_RAND_PCG)
+    static const double expected[] = { 0.93902375081996992, 0.69195744807179027, 0.96977154979709801,
+        0.64983258155403489 };
+#else
+    static const double expected[] = { 0.01092079222805298, 0.88595204108078718, 0.15844584053365721,
+        0.72182009468288388 };
+#endif
+    static t_br_rand r;
+    br_rand_seed(&r, 1);
+    for (int i = 0; i < 4; i++)
+        TEST_ASSERT_TRUE(expected[i] == br_rand_uniform(&r));
+}
+
+void test_philox(void)
+{
+    // the known answers of Random123
+    static const uint32_t ctr[3][4] = { { 0, 0, 0, 0 },
+        { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+        { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 } };
+    static const uint32_t key[3][2] = { { 0, 0 }, { 0xffffffff, 0xffffffff }, { 0xa4093822, 0x299f31d0 } };
+    static const uint32_t expected[3][4] = { { 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 },
+        { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd },
+        { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 } };
+
+    for (int i = 0; i < 3; i++) {
+        uint32_t out[4];
+        br_philox4x32(ctr[i], key[i], out);
+        TEST_ASSERT_EQUAL_HEX32_ARRAY(expected[i], out, 4);
+    }
+
+    // a stream read in one go
+    enum { n = 1000 };
+    static double whole[n], split[n];
+    t_br_philox r;
+    br_philox_seed(&r, 5, 3);
+    for (int i = 0; i < n; i++)
+        whole[i] = br_philox_uniform(&r);
+
+    // is the same when parts of it are filled by independent states, as
+    // threads would, in any order and from any position
+    static const int cuts[] = { 0, 1, 7, 8, 333, 600, 999, n };
+    for (int c = 6; c >= 0; c--) {
+        t_br_philox part;
+        br_philox_seed(&part, 5, 3);
+        br_philox_seek(&part, cuts[c]);
+        br_philox_fill(&part, split + cuts[c], cuts[c + 1] - cuts[c]);
+    }
+    for (int i = 0; i < n; i++)
+        TEST_ASSERT_TRUE(whole[i] == split[i]);
+
+    for (int i = 0; i < n; i += 37)
+        TEST_ASSERT_TRUE(whole[i] == br_philox_at(5, 3, i));
+
+    // other voices and seeds are other streams
+    TEST_ASSERT_FALSE(whole[0] == br_philox_at(5, 4, 0));
+    TEST_ASSERT_FALSE(whole[0] == br_philox_at(6, 3, 0));
+}
+
+void test_gendy_output(void)
+{
+    t_object* x = host_new("gendy~", 0, 0);
+    host_float(x, "minfreq", 1000);
+    host_float(x, "maxfreq", 2000);
+    TEST_ASSERT_EQUAL_INT(0, host_dsp(x, 64));
+
+    static t_sample out[64 * 200];
+    render(x, 200, out);
+
+    int crossings = 0;
+    for (int i = 0; i < 64 * 200; i++) {
+        TEST_ASSERT_TRUE(out[i] >= -1.f && out[i] <= 1.f);
+        crossings += i > 0 && (out[i - 1] < 0) != (out[i] < 0);
+    }
+    TEST_ASSERT_TRUE(crossings > 0);
+
+    host_free(x);
+}
+
+void test_gendy_seed(void)
+{
+    // instances run their own generators, the same seed gives the same
+    // output however the instances interleave
+    t_object* a = host_new("gendy~", 0, 0);
+    t_object* b = host_new("gendy~", 0, 0);
+    t_object* c = host_new("gendy~", 0, 0);
+    host_float(a, "seed", 7);
+    host_float(b, "seed", 7);
+    host_float(c, "seed", 8);
+    host_dsp(a, 64);
+    host_dsp(b, 64);
+    host_dsp(c, 64);
+
+    bool differs = false;
+    for (int i = 0; i < 100; i++) {
+        host_tick(a);
+        host_tick(c);
+        host_tick(b);
+        TEST_ASSERT_EQUAL_FLOAT_ARRAY(host_out(a, 0), host_out(b, 0), 64);
+        differs |= memcmp(host_out(a, 0), host_out(c, 0), 64 * sizeof(t_sample)) != 0;
+    }
+    TEST_ASSERT_TRUE(differs);
+
+    // seeding again starts over
+    static t_sample first[64 * 50], again[64 * 50];
+    host_float(a, "seed", 9);
+    render(a, 50, first);
+    host_float(a, "seed", 9);
+    render(a, 50, again);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(first, again, 64 * 50);
+
+    host_free(a);
+    host_free(b);
+    host_free(c);
+}
+
+void test_bruits_seed(void)
+{
+    static t_sample first[2][64 * 50], again[64 * 50];
+    t_object* bruits = host_bound("bruits");
+    TEST_ASSERT_NOT_NULL(bruits);
+
+    // a patch opened after the same master seed renders the same
+    host_sendlist(bruits, "seed 3");
+    t_object* a = host_new("gendy~", 0, 0);
+    t_object* b = host_new("gendy~", 0, 0);
+    host_dsp(a, 64);
+    host_dsp(b, 64);
+    render(a, 50, first[0]);
+    render(b, 50, first[1]);
+    TEST_ASSERT_FALSE(memcmp(first[0], first[1], sizeof(first[0])) == 0);
+    host_free(a);
+    host_free(b);
+
+    host_sendlist(bruits, "seed 3");
+    a = host_new("gendy~", 0, 0);
+    b = host_new("gendy~", 0, 0);
+    host_dsp(a, 64);
+    host_dsp(b, 64);
+    render(b, 50, again);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(first[1], again, 64 * 50);
+
+    // a new master seed reseeds the existing instances in creation order
+    host_sendlist(bruits, "seed 3");
+    render(a, 50, again);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(first[0], again, 64 * 50);
+
+    // a patch closed and opened again gets the indices of its instances back
+    host_sendlist(bruits, "seed 3");
+    host_free(a);
+    host_free(b);
+    a = host_new("gendy~", 0, 0);
+    b = host_new("gendy~", 0, 0);
+    host_dsp(a, 64);
+    host_dsp(b, 64);
+    render(a, 50, again);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(first[0], again, 64 * 50);
+    render(b, 50, again);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(first[1], again, 64 * 50);
+
+    // and a new instance fills the gap a deleted one left
+    host_free(a);
+    a = host_new("gendy~", 0, 0);
+    host_dsp(a, 64);
+    render(a, 50, again);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(first[0], again, 64 * 50);
+
+    // which leaves out the deleted ones
+    host_free(a);
+    host_sendlist(bruits, "seed 3");
+    render(b, 50, again);
+    TEST_ASSERT_EQUAL_FLOAT_ARRAY(first[0], again, 64 * 50);
+
+    host_sendlist(bruits, "seed 4");
+    render(b, 50, again);
+    TEST_ASSERT_FALSE(memcmp(first[0], again, sizeof(again)) == 0);
+    host_free(b);
+}
+
+// --- golden output
+//
+// Fixed configurations are rendered and compared against the reference in
+// test/golden.h. After an intended change of the output, regenerate it
+// with `make golden` and review the diff.
+
+#define GOLDEN_N 512
+
+// the gendy~ references are recorded with the default generator, see
+// test_rand_seeds for the others
+#if defined(BR_RAND_PCG) || defined(BR_RAND_MT) || defined(BR_RAND_PHILOX)
+#define GOLDEN_GENDY false
+#else
+#define GOLDEN_GENDY true
+#endif
+
+typedef struct _golden {
+    const char* name;
+    const char* object;
+    unsigned long seed;
+    const char* messages;
+    float inputfreq;
+    float tolerance;
+    // compares the bounds and zero crossings instead of the samples, for
+    // output that depends on how the compiler reorders the arithmetic
+    bool invariants;
+} t_golden;
+
+static const t_golden golden_configs[] = {
+    { "ross~ default", "ross~", 0, "", 0, 1e-4f, false },
+    { "ross~ pitch 2", "ross~", 0, "pitch 2", 0, 1e-4f, false },
+    { "ross~ a b c", "ross~", 0, "a 0.3; b 0.4; c 12; pitch 1", 0, 1e-4f, false },
+    { "ross~ driven", "ross~", 0, "gain 2; mix 0.25", 110, 1e-4f, false },
+    { "ross~ dry", "ross~", 0, "mix 0; pitch 1", 0, 1e-4f, false },
+    { "ross~ euler", "ross~", 0, "integrator euler; pitch 1", 0, 1e-4f, false },
+    // rk4 at pitch 3 moves by up to 8e-5 between -O0 and the externals' flags
+    { "ross~ rk4", "ross~", 0, "integrator rk4; pitch 3", 0, 5e-4f, false },
+    { "ross~ semi", "ross~", 0, "integrator semi; gain 1; c 9", 220, 1e-4f, false },
+    // the adaptive steps of dopri follow the rounding of the error estimate,
+    // builds with other flags drift off the reference after some 60 samples
+    { "ross~ dopri", "ross~", 0, "integrator dopri; pitch 4", 0, 0.02f, true },
+    { "ross~ dopri driven", "ross~", 0, "integrator dopri; gain 1; mix 0.25", 110, 1e-4f, false },
+    { "lorenz~ default", "lorenz~", 0, "", 0, 1e-4f, false },
+    // chua~ and thomas~ move by up to 6e-4 between -O0 and the externals' flags
+    { "chua~ driven", "chua~", 0, "gain 1; mix 0.25", 110, 1e-3f, false },
+    { "thomas~ rk4", "thomas~", 0, "integrator rk4; pitch 1", 0, 1e-3f, false },
+    { "aizawa~ euler", "aizawa~", 0, "integrator euler; mix 0", 0, 1e-4f, false },
+    { "gendy~ default", "gendy~", 1, "", 0, 1e-6f, false },
+    { "gendy~ cauchy", "gendy~", 2, "knum 4; ampdist 1; durdist 1; minfreq 100; maxfreq 1000", 0, 1e-6f, false },
+    { "gendy~ logist hyperbcos", "gendy~", 3,
+        "knum 32; ampdist 2; durdist 3; ampparam 0.9; durparam 0.2; minfreq 200; maxfreq 400", 0, 1e-6f, false },
+    { "gendy~ arcsine expon", "gendy~", 4,
+        "ampdist 4; durdist 5; ampscale 1; durscale 0.1; minfreq 50; maxfreq 500", 0, 1e-6f, false },
+    { "gendy~ single point", "gendy~", 5, "knum 1; minfreq 1000; maxfreq 1000", 0, 1e-6f, false },
+};
+
+#define GOLDEN_CONFIGS (int)(sizeof(golden_configs) / sizeof(golden_configs[0]))
+
+static void golden_render(const t_golden* g, int blocksize, float* dest)
+{
+    t_object* x = host_new(g->object, 0, 0);
+    if (g->seed)
+        host_float(x, "seed", g->seed);
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, host_sendlist(x, g->messages), g->name);
+    host_dsp(x, blocksize);
+
+    for (int b = 0; b < GOLDEN_N / blocksize; b++) {
+        if (g->inputfreq > 0) {
+            for (int i = 0; i < blocksize; i++) {
+                int n = b * blocksize + i;
+                host_in(x, 0)[i] = sinf(2 * (float)M_PI * g->inputfreq * n / sys_getsr());
+            }
+        }
+
+        host_tick(x);
+        memcpy(dest + b * blocksize, host_out(x, 0), blocksize * sizeof(float));
+    }
+
+    host_free(x);
+}
+
+#include "test/golden.h"
+
+static int golden_crossings(const float* x)
+{
+    int n = 0;
+    for (int i = 1; i < GOLDEN_N; i++)
+        n += (x[i - 1] < 0) != (x[i] < 0);
+    return n;
+}
+
+static void golden_bounds(const float* x, float* lo, float* hi)
+{
+    *lo = *hi = x[0];
+    for (int i = 1; i < GOLDEN_N; i++) {
+        *lo = fminf(*lo, x[i]);
+        *hi = fmaxf(*hi, x[i]);
+    }
+}
+
+// the same orbit, within the tolerance on its bounds and a crossing on the
+// number of zero crossings
+static void golden_compare_invariants(const t_golden* g, const float* ref, const float* out, int blocksize)
+{
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%s, blocksize %d", g->name, blocksize);
+
+    float reflo, refhi, lo, hi;
+    golden_bounds(ref, &reflo, &refhi);
+    golden_bounds(out, &lo, &hi);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(g->tolerance, reflo, lo, msg);
+    TEST_ASSERT_FLOAT_WITHIN_MESSAGE(g->tolerance, refhi, hi, msg);
+    TEST_ASSERT_INT_WITHIN_MESSAGE(1, golden_crossings(ref), golden_crossings(out), msg);
+}
+
+static void golden_compare(int blocksize)
+{
+    TEST_ASSERT_EQUAL_INT_MESSAGE(GOLDEN_CONFIGS, sizeof(golden_names) / sizeof(golden_names[0]),
+        "test/golden.h is out of date, run make golden");
+
+    for (int c = 0; c < GOLDEN_CONFIGS; c++) {
+        const t_golden* g = &golden_configs[c];
+        TEST_ASSERT_EQUAL_STRING(g->name, golden_names[c]);
+        if (!GOLDEN_GENDY && !strcmp(g->object, "gendy~"))
+            continue;
+
+        float out[GOLDEN_N];
+        golden_render(g, blocksize, out);
+
+        if (g->invariants) {
+            golden_compare_invariants(g, golden_data[c], out, blocksize);
+            continue;
+        }
+
+        for (int i = 0; i < GOLDEN_N; i++) {
+            char msg[128];
+            snprintf(msg, sizeof(msg), "%s, sample %d, blocksize %d", g->name, i, blocksize);
+            TEST_ASSERT_FLOAT_WITHIN_MESSAGE(g->tolerance, golden_data[c][i], out[i], msg);
+        }
+    }
+}
+
+void test_golden(void)
+{
+    golden_compare(64);
+}
+
+void test_golden_blocksizes(void)
+{
+    golden_compare(1);
+    golden_compare(512);
+}
+
+static int golden_write(const char* path)
+{
+    if (!GOLDEN_GENDY) {
+        fprintf(stderr, "the reference is recorded with the default generator, build without BR_RAND_\n");
+        return 1;
+    }
+
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "// generated by make golden, do not edit\n\n");
+    fprintf(f, "static const char* golden_names[] = {\n");
+    for (int c = 0; c < GOLDEN_CONFIGS; c++)
+        fprintf(f, "    \"%s\",\n", golden_configs[c].name);
+    fprintf(f, "};\n\nstatic const float golden_data[][%d] = {\n", GOLDEN_N);
+
+    for (int c = 0; c < GOLDEN_CONFIGS; c++) {
+        float out[GOLDEN_N];
+        host_init(44100, 64);
+        golden_render(&golden_configs[c], 64, out);
+
+        fprintf(f, "    // %s\n    {", golden_configs[c].name);
+        for (int i = 0; i < GOLDEN_N; i++)
+            fprintf(f, "%s%.9g", i % 8 ? ", " : (i ? ",\n        " : "\n        "), out[i]);
+        fprintf(f, " },\n");
+    }
+
+    fprintf(f, "};\n");
+    fclose(f);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    ross_tilde_setup();
+    rossbank_tilde_setup();
+    lorenz_tilde_setup();
+    chua_tilde_setup();
+    thomas_tilde_setup();
+    aizawa_tilde_setup();
+    gendy_tilde_setup();
+
+    if (argc == 3 && !strcmp(argv[1], "--golden"))
+        return golden_write(argv[2]);
+
     UNITY_BEGIN();
     RUN_TEST(test_minimum);
     RUN_TEST(test_maximum);
     RUN_TEST(test_clamp);
+    RUN_TEST(test_exp2);
+    RUN_TEST(test_host_instantiates);
+    RUN_TEST(test_host_messages);
+    RUN_TEST(test_ross_output);
+    RUN_TEST(test_ross_mixes_input);
+    RUN_TEST(test_ross_ignores_input_when_dry);
+    RUN_TEST(test_ross_silent_input);
+    RUN_TEST(test_ross_follows_samplerate);
+    RUN_TEST(test_ross_integrators_agree);
+    RUN_TEST(test_ross_integrator_unknown);
+    RUN_TEST(test_ross_dopri_high_pitch);
+    RUN_TEST(test_ross_double);
+    RUN_TEST(test_ross_pitch_inlet);
+    RUN_TEST(test_ross_coefficient_inlets);
+    RUN_TEST(test_ross_ramp);
+    RUN_TEST(test_ross_cache);
+    RUN_TEST(test_ross_stats);
+    RUN_TEST(test_ross_autoreset);
+    RUN_TEST(test_ross_state_restore);
+    RUN_TEST(test_ross_initial_state);
+    RUN_TEST(test_ross_yz_outlets);
+    RUN_TEST(test_ross_unknown_argument);
+    RUN_TEST(test_rossbank_arguments);
+    RUN_TEST(test_rossbank_matches_ross);
+    RUN_TEST(test_rossbank_sums_voices);
+    RUN_TEST(test_rossbank_couples_voices);
+    RUN_TEST(test_rossbank_messages);
+    RUN_TEST(test_attractors_output);
+    RUN_TEST(test_attractors_integrators_agree);
+    RUN_TEST(test_attractor_params);
+    RUN_TEST(test_mt_state);
+    RUN_TEST(test_rand);
+    RUN_TEST(test_rand_seeds);
+    RUN_TEST(test_philox);
+    RUN_TEST(test_gendy_output);
+    RUN_TEST(test_gendy_seed);
+    RUN_TEST(test_bruits_seed);
+    RUN_TEST(test_golden);
+    RUN_TEST(test_golden_blocksizes);
     return UNITY_END();
 }
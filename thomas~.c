@@ -0,0 +1,45 @@
+#include "attractor.h"
+
+// Thomas' cyclically symmetric attractor
+//
+// dx = sin y - b x, dy = sin z - b y, dz = sin x - b z
+// with the input driving y
+
+static t_class* thomas_class;
+
+static const t_attractor_param thomas_params[] = {
+    { "b", 0.208186f, 0.f, 1.f },
+};
+
+static inline void thomas_field(const float* s, const float* p, float pert, float* slope)
+{
+    slope[0] = sinf(s[1]) - p[0] * s[0];
+    slope[1] = sinf(s[2]) - p[0] * s[1] + pert;
+    slope[2] = sinf(s[0]) - p[0] * s[2];
+}
+
+static t_int* thomas_perform(t_int* w)
+{
+    return attractor_perform(w, thomas_field);
+}
+
+static const t_attractor_model thomas_model = {
+    .name = "thomas~",
+    .perform = thomas_perform,
+    .params = thomas_params,
+    .nparams = 1,
+    .init = { 0.1f, 0.f, 0.f },
+    .bound = 20.f,
+    .scale = 1.f / 5.f,
+    .speed = 2.8f,
+};
+
+static void* thomas_new(void)
+{
+    return attractor_new(thomas_class, &thomas_model);
+}
+
+void thomas_tilde_setup(void)
+{
+    thomas_class = attractor_class_new(&thomas_model, (t_newmethod)thomas_new);
+}